@@ -0,0 +1,46 @@
+#ifndef FIXSTR_BENCHMARK_BENCH_HPP
+#define FIXSTR_BENCHMARK_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench
+{
+
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile auto* sink = &value;
+    (void)sink;
+#endif
+}
+
+// Runs `body(iterations)` several times and returns the best observed time per iteration in nanoseconds
+template <typename Body>
+double run(std::size_t iterations, Body&& body, int repetitions = 5)
+{
+    double best = 0;
+    for (int i = 0; i < repetitions; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        body(iterations);
+        const auto stop = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+        best = i == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+inline void report(const char* name, double ns_per_op)
+{
+    std::printf("%-56s %10.2f ns/op\n", name, ns_per_op);
+}
+
+} // namespace bench
+
+#endif // FIXSTR_BENCHMARK_BENCH_HPP
@@ -0,0 +1,70 @@
+#include "bench.hpp"
+
+#include <fixed_string.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+template <std::size_t N>
+void run()
+{
+    std::mt19937                         rng(42);
+    constexpr std::size_t mask = 4095;
+    std::vector<fixstr::fixed_string<N>> keys(mask + 1);
+    for (auto& key : keys)
+    {
+        // mostly shared prefixes, like exchange symbols
+        for (auto& ch : key)
+            ch = 'A';
+        key[N - 1 - rng() % (N < 4 ? N : 4)] = static_cast<char>('A' + rng() % 4);
+    }
+
+    constexpr std::size_t iterations = 1 << 22;
+    const std::string     suffix = "<" + std::to_string(N) + ">";
+
+    bench::report(("fixed_string" + suffix + " ==").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(keys[i & mask] == keys[(i * 7 + 1) & mask]);
+                  }));
+    bench::report(("string_view" + suffix + " ==").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::string_view(keys[i & mask]) == std::string_view(keys[(i * 7 + 1) & mask]));
+                  }));
+    bench::report(("fixed_string" + suffix + " <").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(keys[i & mask] < keys[(i * 7 + 1) & mask]);
+                  }));
+    bench::report(("string_view" + suffix + " <").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::string_view(keys[i & mask]) < std::string_view(keys[(i * 7 + 1) & mask]));
+                  }));
+
+    // the zeroed tail of aligned storage is compared too, which replaces the overlapping tail load by whole blocks
+    using aligned_string = fixstr::basic_fixed_string<char, N, std::char_traits<char>, fixstr::aligned<(N < 16 ? 16 : 32)>>;
+    const std::vector<aligned_string> aligned_keys(keys.begin(), keys.end());
+    const std::string                 aligned_suffix = suffix + " aligned<" + std::to_string(alignof(aligned_string)) + ">";
+    bench::report(("fixed_string" + aligned_suffix + " ==").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(aligned_keys[i & mask] == aligned_keys[(i * 7 + 1) & mask]);
+                  }));
+    bench::report(("fixed_string" + aligned_suffix + " <").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(aligned_keys[i & mask] < aligned_keys[(i * 7 + 1) & mask]);
+                  }));
+}
+} // namespace
+
+int main()
+{
+    run<8>();
+    run<12>();
+    run<15>();
+    run<16>();
+    run<24>();
+    run<32>();
+    run<64>();
+}
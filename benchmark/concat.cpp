@@ -0,0 +1,58 @@
+#include "bench.hpp"
+
+#include <fixed_string.hpp>
+
+#include <array>
+#include <string>
+#include <utility>
+
+namespace
+{
+using piece = fixstr::fixed_string<4>;
+
+template <std::size_t... Is>
+auto chain(const std::array<piece, sizeof...(Is)>& pieces, std::index_sequence<Is...>)
+{
+    return (... + pieces[Is]);
+}
+
+template <std::size_t... Is>
+auto variadic(const std::array<piece, sizeof...(Is)>& pieces, std::index_sequence<Is...>)
+{
+    return fixstr::concat(pieces[Is]...);
+}
+
+template <std::size_t Operands>
+void run()
+{
+    std::array<piece, Operands> pieces{};
+    for (std::size_t i = 0; i < Operands; ++i)
+        for (auto& ch : pieces[i])
+            ch = static_cast<char>('a' + i % 26);
+
+    constexpr std::size_t iterations = (1 << 24) / Operands;
+    const std::string     suffix = " (" + std::to_string(Operands) + " operands)";
+
+    bench::report(("operator+ chain" + suffix).c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          bench::do_not_optimize(pieces);
+                          bench::do_not_optimize(chain(pieces, std::make_index_sequence<Operands>{}));
+                      }
+                  }));
+    bench::report(("fixstr::concat" + suffix).c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          bench::do_not_optimize(pieces);
+                          bench::do_not_optimize(variadic(pieces, std::make_index_sequence<Operands>{}));
+                      }
+                  }));
+}
+} // namespace
+
+int main()
+{
+    run<2>();
+    run<8>();
+    run<64>();
+}
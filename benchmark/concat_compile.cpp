@@ -0,0 +1,34 @@
+// Compile-time cost of concatenation chains. Every configuration is built as a separate object library:
+// time e.g. `cmake --build . --target benchmark-concat-compile-plus-64` against `benchmark-concat-compile-concat-64`.
+
+#include <fixed_string.hpp>
+
+#include <utility>
+
+namespace
+{
+template <std::size_t I>
+constexpr fixstr::fixed_string<4> piece()
+{
+    fixstr::fixed_string<4> result = "p000";
+    result[1] = static_cast<char>('0' + I / 100 % 10);
+    result[2] = static_cast<char>('0' + I / 10 % 10);
+    result[3] = static_cast<char>('0' + I % 10);
+    return result;
+}
+
+template <std::size_t... Is>
+constexpr auto make(std::index_sequence<Is...>)
+{
+#if FIXSTR_BENCH_USE_CONCAT
+    return fixstr::concat(piece<Is>()...);
+#else
+    return (... + piece<Is>());
+#endif
+}
+
+constexpr auto result = make(std::make_index_sequence<FIXSTR_BENCH_OPERANDS>{});
+static_assert(result.size() == 4 * FIXSTR_BENCH_OPERANDS);
+} // namespace
+
+const char* concat_compile_result() { return result.c_str(); }
@@ -0,0 +1,84 @@
+#include "bench.hpp"
+
+#include <fixstr/deferred_log.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct tick
+{
+    double                 price;
+    std::uint32_t          quantity;
+    fixstr::fixed_string<8> symbol;
+};
+
+template <typename Log>
+void latency(const char* name, const std::vector<tick>& ticks, Log&& log)
+{
+    constexpr std::size_t samples = 200000;
+    std::vector<double>   ns(samples);
+    for (std::size_t i = 0; i < samples; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        log(ticks[i % ticks.size()]);
+        const auto stop = std::chrono::steady_clock::now();
+        ns[i] = std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+    std::sort(ns.begin(), ns.end());
+    bench::report((std::string(name) + " p50").c_str(), ns[samples / 2]);
+    bench::report((std::string(name) + " p99").c_str(), ns[samples * 99 / 100]);
+    bench::report((std::string(name) + " p99.9").c_str(), ns[samples * 999 / 1000]);
+}
+} // namespace
+
+int main()
+{
+    std::mt19937      rng(42);
+    std::vector<tick> ticks(4096);
+    for (auto& t : ticks)
+    {
+        t.price = static_cast<double>(rng() % 1000000) / 100;
+        t.quantity = rng() % 10000;
+        for (auto& ch : t.symbol)
+            ch = static_cast<char>('A' + rng() % 26);
+    }
+    constexpr std::size_t mask = 4095;
+    constexpr std::size_t iterations = 1 << 19;
+
+    std::ofstream deferred_sink("/dev/null");
+    std::ofstream direct_sink("/dev/null");
+    {
+        // Large enough for every benchmarked message, so nothing is dropped while the consumer catches up
+        fixstr::deferred_logger logger(deferred_sink, std::size_t(1) << 27);
+        const auto              deferred = [&](const tick& t) { logger.log<"px={} qty={} sym={}">(t.price, t.quantity, t.symbol); };
+
+        bench::report("deferred_logger::log (logging thread)", bench::run(iterations, [&](std::size_t n) {
+                          for (std::size_t i = 0; i < n; ++i)
+                              deferred(ticks[i & mask]);
+                      }));
+        logger.flush();
+        bench::report("deferred_logger::log (until written)", bench::run(iterations, [&](std::size_t n) {
+                          for (std::size_t i = 0; i < n; ++i)
+                              deferred(ticks[i & mask]);
+                          logger.flush();
+                      }));
+        latency("deferred_logger::log", ticks, deferred);
+        logger.flush();
+        std::printf("dropped messages: %zu\n", logger.dropped());
+    }
+
+    const auto direct = [&](const tick& t) { direct_sink << "px=" << t.price << " qty=" << t.quantity << " sym=" << t.symbol << '\n'; };
+    bench::report("std::ostream operator<<", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          direct(ticks[i & mask]);
+                      direct_sink.flush();
+                  }));
+    latency("std::ostream operator<<", ticks, direct);
+}
@@ -0,0 +1,88 @@
+#include "bench.hpp"
+
+#include <fixstr/enum_names.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+enum class exec_type : std::uint8_t
+{
+    new_order,
+    partial_fill,
+    fill,
+    done_for_day,
+    canceled,
+    replaced,
+    pending_cancel,
+    stopped,
+    rejected,
+    suspended,
+    pending_new,
+    calculated,
+    expired,
+    restated,
+    pending_replace,
+    trade
+};
+
+// the hand-written maps this facility replaces
+const std::unordered_map<exec_type, std::string>& names_by_value()
+{
+    static const std::unordered_map<exec_type, std::string> map = [] {
+        std::unordered_map<exec_type, std::string> result;
+        for (std::size_t i = 0; i < fixstr::enum_names<exec_type>::size(); ++i)
+            result.emplace(fixstr::enum_names<exec_type>::value(i), fixstr::enum_names<exec_type>::name(i));
+        return result;
+    }();
+    return map;
+}
+
+const std::unordered_map<std::string_view, exec_type>& values_by_name()
+{
+    static const std::unordered_map<std::string_view, exec_type> map = [] {
+        std::unordered_map<std::string_view, exec_type> result;
+        for (std::size_t i = 0; i < fixstr::enum_names<exec_type>::size(); ++i)
+            result.emplace(fixstr::enum_names<exec_type>::name(i), fixstr::enum_names<exec_type>::value(i));
+        return result;
+    }();
+    return map;
+}
+} // namespace
+
+int main()
+{
+    using names = fixstr::enum_names<exec_type>;
+
+    std::mt19937                  rng(42);
+    constexpr std::size_t         mask = 4095;
+    std::vector<exec_type>        values(mask + 1);
+    std::vector<std::string_view> strings(mask + 1);
+    for (std::size_t i = 0; i <= mask; ++i)
+    {
+        values[i] = names::value(rng() % names::size());
+        strings[i] = names::to_string(values[i]);
+    }
+
+    constexpr std::size_t iterations = 1 << 22;
+    bench::report("enum_names::to_string", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(names::to_string(values[i & mask]));
+                  }));
+    bench::report("unordered_map<E, string>::find", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(names_by_value().find(values[i & mask]));
+                  }));
+    bench::report("enum_names::from_string", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(names::from_string(strings[i & mask]));
+                  }));
+    bench::report("unordered_map<string_view, E>::find", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(values_by_name().find(strings[i & mask]));
+                  }));
+}
@@ -0,0 +1,62 @@
+#include "bench.hpp"
+
+#include <fixstr/fixed_string_array.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t symbol_size = 12;
+using symbol = fixstr::fixed_string<symbol_size>;
+
+template <typename TArray>
+void run(const char* name, const TArray& array, const symbol& wanted)
+{
+    constexpr std::size_t iterations = 16;
+    const std::string     prefix(name);
+    bench::report((prefix + " find_equal").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(array.find_equal(wanted).count());
+                  }));
+    bench::report((prefix + " count_prefix").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(array.count_prefix("AB"));
+                  }));
+    bench::report((prefix + " filter_contains").c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(array.filter_contains('Z').count());
+                  }));
+}
+} // namespace
+
+int main()
+{
+    // one million symbols, each operation scans all of them
+    std::mt19937        rng(42);
+    std::vector<symbol> symbols(1 << 20);
+    for (auto& s : symbols)
+    {
+        for (auto& ch : s)
+            ch = static_cast<char>('A' + rng() % 26);
+    }
+    const symbol wanted = symbols.back();
+
+    constexpr std::size_t iterations = 16;
+    bench::report("std::vector std::count", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::count(symbols.begin(), symbols.end(), wanted));
+                  }));
+    bench::report("std::vector std::count_if starts_with", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::count_if(symbols.begin(), symbols.end(), [](const symbol& s) { return s.starts_with("AB"); }));
+                  }));
+    bench::report("std::vector std::count_if contains", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::count_if(symbols.begin(), symbols.end(), [](const symbol& s) { return s.contains('Z'); }));
+                  }));
+
+    run("rows", fixstr::fixed_string_array<symbol_size>(symbols.begin(), symbols.end()), wanted);
+    run("column blocks", fixstr::fixed_string_array<symbol_size, fixstr::column_layout>(symbols.begin(), symbols.end()), wanted);
+}
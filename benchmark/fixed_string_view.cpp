@@ -0,0 +1,79 @@
+#include "bench.hpp"
+
+#include <fixed_string.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+// fixed-width records as they arrive from a feed: 8-byte symbol, 12-byte order id, 12 bytes of other fields
+constexpr std::size_t record_size = 32;
+constexpr std::size_t symbol_offset = 0;
+constexpr std::size_t order_id_offset = 8;
+} // namespace
+
+int main()
+{
+    std::mt19937          rng(42);
+    constexpr std::size_t mask = 4095;
+    std::string           records((mask + 1) * record_size, ' ');
+    for (std::size_t i = 0; i <= mask; ++i)
+    {
+        char* record = records.data() + i * record_size;
+        for (std::size_t j = 0; j < 4; ++j)
+            record[symbol_offset + j] = static_cast<char>('A' + rng() % 3);
+        for (std::size_t j = 0; j < 12; ++j)
+            record[order_id_offset + j] = static_cast<char>('0' + rng() % 10);
+    }
+    const fixstr::fixed_string<8> wanted = "ABCA    ";
+
+    constexpr std::size_t iterations = 1 << 22;
+    bench::report("copy into fixed_string<8> ==", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          fixstr::fixed_string<8> symbol;
+                          std::copy_n(records.data() + (i & mask) * record_size + symbol_offset, 8, symbol.begin());
+                          bench::do_not_optimize(symbol == wanted);
+                      }
+                  }));
+    bench::report("fixed_string_view<8> ==", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const fixstr::fixed_string_view<8> symbol(records.data() + (i & mask) * record_size + symbol_offset);
+                          bench::do_not_optimize(symbol == wanted);
+                      }
+                  }));
+    bench::report("string_view ==", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const std::string_view symbol(records.data() + (i & mask) * record_size + symbol_offset, 8);
+                          bench::do_not_optimize(symbol == std::string_view(wanted));
+                      }
+                  }));
+
+    bench::report("copy into fixed_string<12> hash", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          fixstr::fixed_string<12> order_id;
+                          std::copy_n(records.data() + (i & mask) * record_size + order_id_offset, 12, order_id.begin());
+                          bench::do_not_optimize(fixstr::hash{}(order_id));
+                      }
+                  }));
+    bench::report("fixed_string_view<12> hash", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const fixstr::fixed_string_view<12> order_id(records.data() + (i & mask) * record_size + order_id_offset);
+                          bench::do_not_optimize(fixstr::hash{}(order_id));
+                      }
+                  }));
+    bench::report("string_view hash", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const std::string_view order_id(records.data() + (i & mask) * record_size + order_id_offset, 12);
+                          bench::do_not_optimize(fixstr::hash{}(order_id));
+                      }
+                  }));
+}
@@ -0,0 +1,77 @@
+#include "bench.hpp"
+
+#include <fixstr/flat_map.hpp>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+using key = fixstr::fixed_string<12>;
+
+template <typename TMap, typename TMakeKey>
+void run(const std::string& name, std::size_t size, const std::vector<key>& keys, const std::vector<key>& misses, TMakeKey make_key)
+{
+    constexpr std::size_t mask = 4095;
+    const std::string     suffix = " " + std::to_string(size);
+
+    TMap map;
+    bench::report((name + " insert" + suffix).c_str(), bench::run(1, [&](std::size_t n) {
+                      for (std::size_t r = 0; r < n; ++r)
+                      {
+                          map = TMap();
+                          for (std::size_t i = 0; i < size; ++i)
+                              map.try_emplace(make_key(keys[i]), i);
+                      }
+                  }) / double(size));
+
+    std::mt19937             rng(7);
+    std::vector<std::size_t> hits(mask + 1);
+    for (auto& hit : hits)
+        hit = rng() % size;
+
+    constexpr std::size_t iterations = 1 << 20;
+    bench::report((name + " find hit" + suffix).c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(map.find(make_key(keys[hits[i & mask]])) != map.end());
+                  }));
+    bench::report((name + " find miss" + suffix).c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(map.find(make_key(misses[i & mask])) != map.end());
+                  }));
+}
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(42);
+    auto         random_key = [&] {
+        key result;
+        for (auto& ch : result)
+            ch = static_cast<char>('A' + rng() % 26);
+        return result;
+    };
+    std::vector<key> keys(1 << 20);
+    for (auto& k : keys)
+        k = random_key();
+    // lowercase keys are never inserted
+    std::vector<key> misses(4096);
+    for (auto& k : misses)
+    {
+        k = random_key();
+        k[0] = 'a';
+    }
+
+    const auto as_is = [](const key& k) -> const key& { return k; };
+    const auto as_view = [](const key& k) { return std::string_view(k); };
+    const auto as_string = [](const key& k) { return std::string(k); };
+    for (const std::size_t size : {std::size_t(1) << 10, std::size_t(1) << 16, std::size_t(1) << 20})
+    {
+        run<fixstr::flat_map<12, std::size_t>>("fixstr::flat_map", size, keys, misses, as_is);
+        run<fixstr::flat_map<12, std::size_t>>("fixstr::flat_map by string_view", size, keys, misses, as_view);
+        run<std::unordered_map<key, std::size_t>>("std::unordered_map<fixed_string>", size, keys, misses, as_is);
+        run<std::unordered_map<std::string, std::size_t>>("std::unordered_map<std::string>", size, keys, misses, as_string);
+    }
+}
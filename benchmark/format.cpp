@@ -0,0 +1,63 @@
+#include "bench.hpp"
+
+#include <fixstr/format.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct order
+{
+    std::uint64_t id;
+    std::uint32_t quantity;
+    double        price;
+};
+} // namespace
+
+int main()
+{
+    std::mt19937          rng(42);
+    constexpr std::size_t mask = 4095;
+    std::vector<order>    orders(mask + 1);
+    for (auto& o : orders)
+        o = {rng() * std::uint64_t(rng()), static_cast<std::uint32_t>(rng() % 10000), static_cast<double>(rng() % 1000000) / 100};
+
+    constexpr std::size_t iterations = 1 << 21;
+
+    bench::report("fixstr::format_to(char*)", bench::run(iterations, [&](std::size_t n) {
+                      char buffer[fixstr::max_formatted_size_v<"order {} filled {}@{}", std::uint64_t, std::uint32_t, double>];
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const auto& o = orders[i & mask];
+                          bench::do_not_optimize(fixstr::format_to<"order {} filled {}@{}">(buffer, o.id, o.quantity, o.price));
+                          bench::do_not_optimize(buffer);
+                      }
+                  }));
+    bench::report("fixstr::format_inplace", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const auto& o = orders[i & mask];
+                          bench::do_not_optimize(fixstr::format_inplace<"order {} filled {}@{}">(o.id, o.quantity, o.price));
+                      }
+                  }));
+    bench::report("snprintf", bench::run(iterations, [&](std::size_t n) {
+                      char buffer[128];
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const auto& o = orders[i & mask];
+                          bench::do_not_optimize(std::snprintf(buffer, sizeof(buffer), "order %llu filled %u@%.17g", static_cast<unsigned long long>(o.id), o.quantity, o.price));
+                          bench::do_not_optimize(buffer);
+                      }
+                  }));
+    bench::report("std::string + std::to_string", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const auto& o = orders[i & mask];
+                          bench::do_not_optimize("order " + std::to_string(o.id) + " filled " + std::to_string(o.quantity) + "@" + std::to_string(o.price));
+                      }
+                  }));
+}
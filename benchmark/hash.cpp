@@ -0,0 +1,44 @@
+#include "bench.hpp"
+
+#include <fixed_string.hpp>
+
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+template <std::size_t N>
+void run(const char* fixstr_name, const char* fnv_name, const char* std_name)
+{
+    std::mt19937                         rng(42);
+    constexpr std::size_t mask = 4095;
+    std::vector<fixstr::fixed_string<N>> keys(mask + 1);
+    for (auto& key : keys)
+        for (auto& ch : key)
+            ch = static_cast<char>('A' + rng() % 26);
+
+    constexpr std::size_t iterations = 1 << 22;
+
+    bench::report(fixstr_name, bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(fixstr::hash()(keys[i & mask]));
+                  }));
+    bench::report(fnv_name, bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(fixstr::fnv1a_hash()(keys[i & mask]));
+                  }));
+    bench::report(std_name, bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::hash<std::string_view>()(keys[i & mask]));
+                  }));
+}
+} // namespace
+
+int main()
+{
+    run<8>("fixstr::hash(fixed_string<8>)", "fixstr::fnv1a_hash(fixed_string<8>)", "std::hash<string_view>(fixed_string<8>)");
+    run<12>("fixstr::hash(fixed_string<12>)", "fixstr::fnv1a_hash(fixed_string<12>)", "std::hash<string_view>(fixed_string<12>)");
+    run<32>("fixstr::hash(fixed_string<32>)", "fixstr::fnv1a_hash(fixed_string<32>)", "std::hash<string_view>(fixed_string<32>)");
+    run<100>("fixstr::hash(fixed_string<100>)", "fixstr::fnv1a_hash(fixed_string<100>)", "std::hash<string_view>(fixed_string<100>)");
+}
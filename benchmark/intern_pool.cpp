@@ -0,0 +1,92 @@
+#include "bench.hpp"
+
+#include <fixstr/intern_pool.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Usage: benchmark-intern-pool [read percent, 90 by default] [maximum number of threads, 8 by default]
+// Every thread runs the same number of operations: lookups of interned identifiers or interning of new ones.
+// The reported time is the wall time per operation of all threads together.
+
+namespace
+{
+class locked_pool
+{
+  public:
+    std::uint32_t intern(const std::string& str)
+    {
+        {
+            std::shared_lock lock(_mutex);
+            if (const auto it = _ids.find(str); it != _ids.end())
+                return it->second;
+        }
+        std::unique_lock lock(_mutex);
+        const auto [it, inserted] = _ids.try_emplace(str, static_cast<std::uint32_t>(_ids.size()));
+        return it->second;
+    }
+
+  private:
+    std::shared_mutex                              _mutex;
+    std::unordered_map<std::string, std::uint32_t> _ids;
+};
+
+template <typename TPool>
+double measure(TPool& pool, const std::vector<std::vector<std::string>>& operations)
+{
+    std::vector<std::thread> threads;
+    const auto               start = std::chrono::steady_clock::now();
+    for (const auto& list : operations)
+        threads.emplace_back([&pool, &list] {
+            for (const auto& str : list)
+                bench::do_not_optimize(pool.intern(str));
+        });
+    for (auto& thread : threads)
+        thread.join();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(operations.size() * operations.front().size());
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const unsigned read_percent = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : 90;
+    const unsigned max_threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 8;
+
+    constexpr std::size_t    interned = 100000;
+    constexpr std::size_t    per_thread = 200000;
+    std::mt19937             rng(42);
+    std::vector<std::string> existing;
+    for (std::size_t i = 0; i < interned; ++i)
+        existing.push_back("sym." + std::to_string(rng() % 100000000));
+
+    std::printf("%u%% lookups of interned identifiers, %u%% new identifiers\n", read_percent, 100 - read_percent);
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::vector<std::vector<std::string>> operations(threads);
+        for (unsigned t = 0; t < threads; ++t)
+            for (std::size_t i = 0; i < per_thread; ++i)
+                operations[t].push_back(rng() % 100 < read_percent ? existing[rng() % interned]
+                                                                   : "new." + std::to_string(t) + "." + std::to_string(i));
+
+        fixstr::intern_pool<16> pool(interned + threads * per_thread);
+        locked_pool             locked;
+        for (const auto& str : existing)
+        {
+            pool.intern(str);
+            locked.intern(str);
+        }
+        const std::string suffix = ", " + std::to_string(threads) + " threads";
+        bench::report(("intern_pool" + suffix).c_str(), measure(pool, operations));
+        bench::report(("std::shared_mutex + std::unordered_map" + suffix).c_str(), measure(locked, operations));
+    }
+}
@@ -0,0 +1,70 @@
+#include "bench.hpp"
+
+#include <fixstr/mapped_dictionary.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using key = fixstr::fixed_string<12>;
+} // namespace
+
+int main()
+{
+    std::mt19937     rng(42);
+    std::vector<key> keys(1 << 22);
+    for (auto& k : keys)
+        for (auto& ch : k)
+            ch = static_cast<char>('A' + rng() % 26);
+
+    const std::string path = "fixstr_benchmark_dictionary.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        fixstr::mapped_dictionary<12>::write(out, keys.begin(), keys.end());
+    }
+
+    // startup: mapping is independent of the size, reading the keys is not
+    bench::report("open mapped_dictionary<12> (4M keys)", bench::run(64, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const fixstr::mapped_dictionary<12> dictionary(path);
+                          bench::do_not_optimize(dictionary.size());
+                      }
+                  }));
+    bench::report("read keys into std::vector (4M keys)", bench::run(1, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          std::ifstream    in(path, std::ios::binary);
+                          std::vector<key> loaded(keys.size());
+                          in.seekg(64);
+                          for (auto& k : loaded)
+                              in.read(k.data(), 12);
+                          bench::do_not_optimize(loaded.data());
+                      }
+                  }));
+
+    const fixstr::mapped_dictionary<12> dictionary(path);
+    constexpr std::size_t               mask = 4095;
+    std::vector<key>                    probes(mask + 1);
+    for (auto& probe : probes)
+        probe = keys[rng() % keys.size()];
+
+    constexpr std::size_t iterations = 1 << 20;
+    bench::report("find, hash index", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(dictionary.find(probes[i & mask]));
+                  }));
+    bench::report("find_sorted, binary search", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(dictionary.find_sorted(probes[i & mask]));
+                  }));
+    bench::report("prefix_range, 3 characters", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(dictionary.prefix_range(std::string_view(probes[i & mask]).substr(0, 3)));
+                  }));
+    std::remove(path.c_str());
+}
@@ -0,0 +1,78 @@
+#include "bench.hpp"
+
+#include <fixstr/multi_search.hpp>
+
+#include <array>
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+
+namespace
+{
+using keywords = fixstr::multi_searcher<"GET ", "POST ", "PUT ", "DELETE ", "HEAD ", "OPTIONS ", "HTTP/1.0", "HTTP/1.1", "Host:",
+                                        "User-Agent:", "Accept:", "Content-Type:", "Content-Length:", "Connection:", "keep-alive",
+                                        "close", "Cookie:", "Set-Cookie:", "Authorization:", "Bearer ", "gzip", "chunked", "json",
+                                        "charset=utf-8", "Cache-Control:", "no-cache", "X-Request-Id:", "Referer:", "Origin:", "\r\n\r\n">;
+
+template <std::size_t... Is>
+std::size_t count_with_find(std::string_view haystack, std::index_sequence<Is...>)
+{
+    std::size_t result = 0;
+    (
+        [&] {
+            const auto pattern = keywords::pattern(Is);
+            for (auto pos = haystack.find(pattern); pos != std::string_view::npos; pos = haystack.find(pattern, pos + 1))
+                ++result;
+        }(),
+        ...);
+    return result;
+}
+} // namespace
+
+int main()
+{
+    // HTTP-like requests with random header values
+    std::mt19937                              rng(42);
+    constexpr std::array<std::string_view, 8> lines = {"GET /index.html HTTP/1.1\r\n", "Host: example.com\r\n",
+                                                       "Accept: application/json; charset=utf-8\r\n", "Connection: keep-alive\r\n",
+                                                       "X-Request-Id: ", "Cookie: session=", "Content-Length: 42\r\n", "\r\n"};
+    std::string                               payload;
+    while (payload.size() < (1 << 16))
+    {
+        payload += lines[rng() % lines.size()];
+        for (auto n = rng() % 48; n > 0; --n)
+            payload.push_back(static_cast<char>('a' + rng() % 26));
+        payload += "\r\n";
+    }
+    const std::string_view haystack = payload;
+
+    std::string alternation;
+    for (std::size_t i = 0; i < keywords::size(); ++i)
+    {
+        if (i != 0)
+            alternation += '|';
+        for (const char ch : keywords::pattern(i))
+        {
+            if (std::string_view("\\^$.|?*+()[]{}/").find(ch) != std::string_view::npos)
+                alternation += '\\';
+            alternation += ch;
+        }
+    }
+    const std::regex regex(alternation, std::regex::optimize);
+
+    std::printf("%zu patterns, %zu byte payload\n", keywords::size(), haystack.size());
+    bench::report("multi_searcher::count", bench::run(64, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(keywords::count(haystack));
+                  }));
+    bench::report("string_view::find per pattern", bench::run(64, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(count_with_find(haystack, std::make_index_sequence<keywords::size()>{}));
+                  }));
+    bench::report("std::regex alternation (non-overlapping)", bench::run(2, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::distance(std::cregex_iterator(haystack.data(), haystack.data() + haystack.size(), regex),
+                                                               std::cregex_iterator()));
+                  }));
+}
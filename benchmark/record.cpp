@@ -0,0 +1,81 @@
+#include "bench.hpp"
+
+#include <fixstr/record.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace
+{
+// 8-byte symbol, 1-byte side, 6-byte zero-padded quantity, 20-byte account, 29 bytes of other fields
+using order = fixstr::record<fixstr::field<"symbol", 8>, fixstr::field<"side", 1>, fixstr::field<"quantity", 6, fixstr::zero_padded>,
+                             fixstr::field<"account", 20>, fixstr::field<"rest", 29>>;
+
+std::string_view trim_loop(const char* data, std::size_t size)
+{
+    while (size > 0 && data[size - 1] == ' ')
+        --size;
+    return {data, size};
+}
+} // namespace
+
+int main()
+{
+    static_assert(order::size == 64);
+    std::mt19937          rng(42);
+    constexpr std::size_t mask = 4095;
+    std::string           records((mask + 1) * order::size, ' ');
+    for (std::size_t i = 0; i <= mask; ++i)
+    {
+        char*             record = records.data() + i * order::size;
+        const std::string symbol(1 + rng() % 8, static_cast<char>('A' + rng() % 26));
+        const std::string account(1 + rng() % 20, static_cast<char>('a' + rng() % 26));
+        order::set<"symbol">(record, symbol);
+        order::set<"side">(record, rng() % 2 ? "B" : "S");
+        order::set<"quantity">(record, std::to_string(rng() % 100000));
+        order::set<"account">(record, account);
+    }
+
+    constexpr std::size_t iterations = 1 << 22;
+    bench::report("scalar trim loop, symbol + account", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const char* record = records.data() + (i & mask) * order::size;
+                          bench::do_not_optimize(trim_loop(record + order::offset_of<"symbol">, 8).size() +
+                                                 trim_loop(record + order::offset_of<"account">, 20).size());
+                      }
+                  }));
+    bench::report("copy into std::string, symbol + account", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const char*       record = records.data() + (i & mask) * order::size;
+                          const std::string symbol(trim_loop(record + order::offset_of<"symbol">, 8));
+                          const std::string account(trim_loop(record + order::offset_of<"account">, 20));
+                          bench::do_not_optimize(symbol.size() + account.size());
+                      }
+                  }));
+    bench::report("record::get trimmed, symbol + account", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const order record(records.data() + (i & mask) * order::size);
+                          bench::do_not_optimize(record.get<"symbol">().trimmed().size() + record.get<"account">().trimmed().size());
+                      }
+                  }));
+
+    const fixstr::padded_string<8> wanted("AAAA");
+    bench::report("string_view == trimmed symbol", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const char* record = records.data() + (i & mask) * order::size;
+                          bench::do_not_optimize(trim_loop(record, 8) == std::string_view("AAAA"));
+                      }
+                  }));
+    bench::report("padded_view == padded_string", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const order record(records.data() + (i & mask) * order::size);
+                          bench::do_not_optimize(record.get<"symbol">() == wanted);
+                      }
+                  }));
+}
@@ -0,0 +1,108 @@
+#include "bench.hpp"
+
+#include <fixstr/router.hpp>
+
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t route_count = 48;
+
+// "/api/rNN/{id:int}", "/api/rNN/{id:int}/items/{item}" or "/api/rNN/list", depending on the route index
+template <std::size_t I>
+constexpr auto make_pattern()
+{
+    using fixstr::fixed_string;
+    constexpr auto prefix = fixstr::concat(fixed_string{"/api/r"}, static_cast<char>('0' + I / 10), static_cast<char>('0' + I % 10));
+    if constexpr (I % 3 == 0)
+        return fixstr::basic_fixed_string(prefix + fixed_string{"/{id:int}"});
+    else if constexpr (I % 3 == 1)
+        return fixstr::basic_fixed_string(prefix + fixed_string{"/{id:int}/items/{item}"});
+    else
+        return fixstr::basic_fixed_string(prefix + fixed_string{"/list"});
+}
+
+template <std::size_t... Is>
+auto make_router(std::index_sequence<Is...>) -> fixstr::router<fixstr::route<make_pattern<Is>()>...>;
+
+using api = decltype(make_router(std::make_index_sequence<route_count>{}));
+
+template <std::size_t... Is>
+std::size_t linear_scan(std::string_view path, std::index_sequence<Is...>)
+{
+    std::size_t result = api::match_type::npos;
+    (void)((api::route_type<Is>::match(path) ? (result = Is, true) : false) || ...);
+    return result;
+}
+
+std::string regex_of(std::string_view pattern)
+{
+    std::string result = "^";
+    for (std::size_t i = 0; i < pattern.size(); ++i)
+    {
+        if (pattern[i] != '{')
+        {
+            result += pattern[i];
+            continue;
+        }
+        const auto close = pattern.find('}', i);
+        result += pattern.substr(i, close - i).find(":int") != std::string_view::npos ? "(-?[0-9]+)" : "([^/]+)";
+        i = close;
+    }
+    return result + "$";
+}
+} // namespace
+
+int main()
+{
+    std::vector<std::regex> regexes;
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        (regexes.emplace_back(regex_of(api::route_type<Is>::pattern), std::regex::optimize), ...);
+    }(std::make_index_sequence<route_count>{});
+
+    // paths spread over all routes, with a few that match nothing
+    std::mt19937             rng(42);
+    constexpr std::size_t    mask = 4095;
+    std::vector<std::string> paths(mask + 1);
+    for (auto& path : paths)
+    {
+        const auto index = rng() % (route_count + 4);
+        const auto id = std::to_string(rng() % 100000);
+        path = "/api/r" + std::to_string(index / 10) + std::to_string(index % 10) + "/";
+        if (index >= route_count)
+            path += "unknown";
+        else if (index % 3 == 0)
+            path += id;
+        else if (index % 3 == 1)
+            path += id + "/items/sku-" + std::to_string(rng() % 1000);
+        else
+            path += "list";
+    }
+
+    constexpr std::size_t iterations = 1 << 16;
+    bench::report("router::match", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(api::match(paths[i & mask]));
+                  }));
+    bench::report("route::match linear scan", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(linear_scan(paths[i & mask], std::make_index_sequence<route_count>{}));
+                  }));
+    bench::report("std::regex_match linear scan", bench::run(iterations / 64, [&](std::size_t n) {
+                      std::smatch captures;
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const auto& path = paths[i & mask];
+                          std::size_t result = api::match_type::npos;
+                          for (std::size_t r = 0; r < regexes.size() && result == api::match_type::npos; ++r)
+                              if (std::regex_match(path, captures, regexes[r]))
+                                  result = r;
+                          bench::do_not_optimize(result);
+                      }
+                  }));
+}
@@ -0,0 +1,64 @@
+#include "bench.hpp"
+
+#include <fixed_string.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace
+{
+template <fixstr::basic_fixed_string Needle>
+void run(const char* payload_name, const std::string& payload)
+{
+    const std::string_view     view = payload;
+    constexpr std::string_view needle = Needle;
+    constexpr std::size_t      iterations = 64;
+    const std::string          suffix = "<" + std::to_string(needle.size()) + "> " + payload_name;
+
+    bench::report(("searcher" + suffix).c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(fixstr::searcher<Needle>::find(view));
+                  }));
+    bench::report(("string_view::find" + suffix).c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(view.find(needle));
+                  }));
+    const std::boyer_moore_horspool_searcher horspool(needle.begin(), needle.end());
+    bench::report(("std::boyer_moore_horspool_searcher" + suffix).c_str(), bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(std::search(view.begin(), view.end(), horspool));
+                  }));
+}
+} // namespace
+
+int main()
+{
+    // each needle appears once near the end of a 1 MiB payload
+    std::mt19937 rng(42);
+
+    // the first needle byte is rare, which is the best case for memchr-driven searches
+    std::string rare(1 << 20, ' ');
+    for (auto& ch : rare)
+        ch = static_cast<char>('a' + rng() % 26);
+    for (std::size_t i = 0; i + 4 < rare.size(); i += 997)
+        rare.replace(i, 3, "<#!");
+    rare.replace(rare.size() - 64, 32, "<#!MARKER:ffffffffffffffffffff>>");
+
+    // text-like payload where the first needle byte occurs every few characters
+    std::string text(1 << 20, ' ');
+    for (auto& ch : text)
+        ch = rng() % 4 == 0 ? 's' : static_cast<char>('a' + rng() % 26);
+    text.replace(text.size() - 64, 32, "session=0123456789abcdef:trailer");
+
+    run<"<#!M">("rare", rare);
+    run<"<#!MARKE">("rare", rare);
+    run<"<#!MARKER:ffffff">("rare", rare);
+    run<"<#!MARKER:ffffffffffffffffffff>>">("rare", rare);
+    run<"sess">("text", text);
+    run<"session=">("text", text);
+    run<"session=01234567">("text", text);
+    run<"session=0123456789abcdef:trailer">("text", text);
+}
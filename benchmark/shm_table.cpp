@@ -0,0 +1,91 @@
+#include "bench.hpp"
+
+#include <fixstr/shm_table.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+using key = fixstr::fixed_string<12>;
+
+struct quote
+{
+    std::uint64_t bid;
+    std::uint64_t ask;
+};
+
+// Runs `reader` on the calling thread while `writers` background threads keep calling `writer`
+template <typename TWriter, typename TReader>
+double measure(unsigned writers, TWriter writer, TReader reader)
+{
+    std::atomic<bool>        stop{false};
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < writers; ++t)
+        threads.emplace_back([&] {
+            for (std::size_t i = 0; !stop.load(std::memory_order_relaxed); ++i)
+                writer(i);
+        });
+    const double result = bench::run(1 << 20, reader);
+    stop = true;
+    for (auto& thread : threads)
+        thread.join();
+    return result;
+}
+} // namespace
+
+int main()
+{
+    std::mt19937          rng(42);
+    constexpr std::size_t count = 100000;
+    std::vector<key>      keys(count);
+    for (auto& k : keys)
+        for (auto& ch : k)
+            ch = static_cast<char>('A' + rng() % 26);
+    constexpr std::size_t    mask = 4095;
+    std::vector<std::size_t> probes(mask + 1);
+    for (auto& probe : probes)
+        probe = rng() % count;
+
+    using table_type = fixstr::shm_table<12, quote>;
+    std::vector<std::uint64_t> region(table_type::required_size(count) / sizeof(std::uint64_t) + 1);
+    auto table = table_type::create(region.data(), region.size() * sizeof(std::uint64_t), count);
+
+    std::unordered_map<key, quote> map;
+    std::shared_mutex              mutex;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        table.insert_or_assign(keys[i], quote{i, i + 1});
+        map[keys[i]] = quote{i, i + 1};
+    }
+
+    for (const unsigned writers : {0u, 1u})
+    {
+        const std::string suffix = writers == 0 ? ", no writer" : ", writer updating";
+        bench::report(("shm_table find" + suffix).c_str(), measure(
+                                                               writers, [&](std::size_t i) { table.insert_or_assign(keys[i % count], quote{i, i + 1}); },
+                                                               [&](std::size_t n) {
+                                                                   for (std::size_t i = 0; i < n; ++i)
+                                                                       bench::do_not_optimize(table.find(keys[probes[i & mask]]));
+                                                               }));
+        bench::report(("std::shared_mutex + std::unordered_map find" + suffix).c_str(), measure(
+                          writers,
+                          [&](std::size_t i) {
+                              std::unique_lock lock(mutex);
+                              map[keys[i % count]] = quote{i, i + 1};
+                          },
+                          [&](std::size_t n) {
+                              for (std::size_t i = 0; i < n; ++i)
+                              {
+                                  std::shared_lock lock(mutex);
+                                  bench::do_not_optimize(map.find(keys[probes[i & mask]])->second);
+                              }
+                          }));
+    }
+}
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+
+#include <fixstr/sort.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if FIXSTR_BENCH_PARALLEL_STL
+#include <execution>
+#endif // FIXSTR_BENCH_PARALLEL_STL
+
+namespace
+{
+using key = fixstr::fixed_string<12>;
+
+template <typename TSort>
+void run(const std::string& name, const std::vector<key>& keys, TSort sort)
+{
+    std::vector<key> copy;
+    bench::report((name + " " + std::to_string(keys.size())).c_str(), bench::run(1, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          copy = keys;
+                          sort(copy);
+                          bench::do_not_optimize(copy.data());
+                      }
+                  }) / double(keys.size()));
+}
+} // namespace
+
+int main()
+{
+    // per-key times; symbols share 3-letter prefixes like exchange-qualified tickers
+    std::mt19937   rng(42);
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    for (const std::size_t size : {std::size_t(1) << 20, std::size_t(10) << 20})
+    {
+        std::vector<key> keys(size);
+        for (auto& k : keys)
+        {
+            const unsigned venue = rng() % 8;
+            for (std::size_t i = 0; i < 3; ++i)
+                k[i] = static_cast<char>('A' + venue + i);
+            for (std::size_t i = 3; i < k.size(); ++i)
+                k[i] = static_cast<char>('A' + rng() % 26);
+        }
+
+        run("copy only", keys, [](std::vector<key>&) {});
+        run("std::sort", keys, [](std::vector<key>& v) { std::sort(v.begin(), v.end()); });
+#if FIXSTR_BENCH_PARALLEL_STL
+        run("std::sort(std::execution::par)", keys, [](std::vector<key>& v) { std::sort(std::execution::par, v.begin(), v.end()); });
+#endif // FIXSTR_BENCH_PARALLEL_STL
+        run("fixstr::sort", keys, [](std::vector<key>& v) { fixstr::sort(v.begin(), v.end()); });
+        run("fixstr::sort " + std::to_string(threads) + " threads", keys,
+            [&](std::vector<key>& v) { fixstr::sort(v.begin(), v.end(), threads); });
+        run("std::sort + std::unique", keys, [](std::vector<key>& v) {
+            std::sort(v.begin(), v.end());
+            v.erase(std::unique(v.begin(), v.end()), v.end());
+        });
+        run("fixstr::sort_unique " + std::to_string(threads) + " threads", keys,
+            [&](std::vector<key>& v) { v.erase(fixstr::sort_unique(v.begin(), v.end(), threads), v.end()); });
+    }
+}
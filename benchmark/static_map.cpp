@@ -0,0 +1,74 @@
+#include "bench.hpp"
+
+#include <fixstr/static_map.hpp>
+
+#include <random>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t key_count = 256;
+
+template <std::size_t I>
+constexpr fixstr::fixed_string<8> make_key()
+{
+    fixstr::fixed_string<8> key = "MSG00000";
+    key[5] = static_cast<char>('0' + I / 100 % 10);
+    key[6] = static_cast<char>('0' + I / 10 % 10);
+    key[7] = static_cast<char>('0' + I % 10);
+    return key;
+}
+
+template <std::size_t... Is>
+constexpr auto make_map(std::index_sequence<Is...>)
+{
+    return fixstr::static_map<fixstr::map_entry{make_key<Is>(), static_cast<int>(Is)}...>{};
+}
+
+using map_type = decltype(make_map(std::make_index_sequence<key_count>{}));
+} // namespace
+
+int main()
+{
+    std::unordered_map<fixstr::fixed_string<8>, int> unordered;
+    std::unordered_map<std::string_view, int>        unordered_sv;
+    for (std::size_t i = 0; i < key_count; ++i)
+    {
+        fixstr::fixed_string<8> key;
+        const auto              sv = map_type::key(i);
+        std::copy(sv.begin(), sv.end(), key.begin());
+        unordered.emplace(key, static_cast<int>(i));
+        unordered_sv.emplace(sv, static_cast<int>(i));
+    }
+
+    std::mt19937                  rng(42);
+    constexpr std::size_t mask = 4095;
+    std::vector<std::string_view> queries(mask + 1);
+    for (auto& query : queries)
+        query = map_type::key(rng() % key_count);
+
+    constexpr std::size_t iterations = 1 << 22;
+
+    bench::report("static_map::find(string_view)", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(map_type::find(queries[i & mask]));
+                  }));
+
+    bench::report("unordered_map<fixed_string<8>, int>::find", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          const auto&             sv = queries[i & mask];
+                          fixstr::fixed_string<8> key;
+                          std::copy(sv.begin(), sv.end(), key.begin());
+                          bench::do_not_optimize(unordered.find(key));
+                      }
+                  }));
+
+    bench::report("unordered_map<string_view, int>::find", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(unordered_sv.find(queries[i & mask]));
+                  }));
+}
@@ -0,0 +1,83 @@
+#include "bench.hpp"
+
+#include <fixstr/string_switch.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+using tags = fixstr::switch_table<"NEW", "CANCEL", "REPLACE", "STATUS", "REJECT", "FILL", "PARTIAL", "EXPIRE", "RESTATE", "SUSPEND",
+                                  "HEARTBEAT", "LOGON", "LOGOUT", "TRADE", "QUOTE">;
+
+std::size_t if_chain(std::string_view tag)
+{
+    if (tag == "NEW")
+        return 0;
+    else if (tag == "CANCEL")
+        return 1;
+    else if (tag == "REPLACE")
+        return 2;
+    else if (tag == "STATUS")
+        return 3;
+    else if (tag == "REJECT")
+        return 4;
+    else if (tag == "FILL")
+        return 5;
+    else if (tag == "PARTIAL")
+        return 6;
+    else if (tag == "EXPIRE")
+        return 7;
+    else if (tag == "RESTATE")
+        return 8;
+    else if (tag == "SUSPEND")
+        return 9;
+    else if (tag == "HEARTBEAT")
+        return 10;
+    else if (tag == "LOGON")
+        return 11;
+    else if (tag == "LOGOUT")
+        return 12;
+    else if (tag == "TRADE")
+        return 13;
+    else if (tag == "QUOTE")
+        return 14;
+    return tags::npos;
+}
+} // namespace
+
+int main()
+{
+    std::unordered_map<std::string_view, std::size_t> unordered;
+    for (std::size_t i = 0; i < tags::size(); ++i)
+        unordered.emplace(tags::key(i), i);
+
+    // mostly known tags with a few unknown ones, in random order
+    std::mt19937                  rng(42);
+    constexpr std::size_t         mask = 4095;
+    std::vector<std::string>      storage(mask + 1);
+    std::vector<std::string_view> queries(mask + 1);
+    for (std::size_t i = 0; i <= mask; ++i)
+    {
+        storage[i] = rng() % 16 == 0 ? std::string("UNKNOWN") : std::string(tags::key(rng() % tags::size()));
+        queries[i] = storage[i];
+    }
+
+    constexpr std::size_t iterations = 1 << 22;
+    std::printf("%zu tags, strategy %d\n", tags::size(), static_cast<int>(tags::strategy));
+    bench::report("string_switch", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(tags::index_of(queries[i & mask]));
+                  }));
+    bench::report("if (sv == ...) else if chain", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(if_chain(queries[i & mask]));
+                  }));
+    bench::report("unordered_map<string_view, size_t>::find", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(unordered.find(queries[i & mask]));
+                  }));
+}
@@ -0,0 +1,56 @@
+#include "bench.hpp"
+
+#include <fixstr/type_name.hpp>
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define FIXSTR_BENCH_HAS_CXXABI 1
+#else
+#define FIXSTR_BENCH_HAS_CXXABI 0
+#endif
+
+namespace
+{
+namespace telemetry
+{
+struct order_ack
+{
+};
+
+template <typename T>
+struct envelope
+{
+};
+} // namespace telemetry
+
+using tagged = telemetry::envelope<std::map<int, std::vector<telemetry::order_ack>>>;
+} // namespace
+
+int main()
+{
+    constexpr std::size_t iterations = 1 << 16;
+    std::printf("%s\n", fixstr::type_name_v<tagged>.c_str());
+
+    // what startup code does today for every tagged type, and what is left with the name available at compile time
+#if FIXSTR_BENCH_HAS_CXXABI
+    bench::report("hash(abi::__cxa_demangle(typeid(T).name()))", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                      {
+                          int   status = 0;
+                          char* name = abi::__cxa_demangle(typeid(tagged).name(), nullptr, nullptr, &status);
+                          bench::do_not_optimize(fixstr::hash{}(std::string_view(name)));
+                          std::free(name);
+                      }
+                  }));
+#endif // FIXSTR_BENCH_HAS_CXXABI
+    bench::report("fixstr::type_hash_v<T>", bench::run(iterations, [&](std::size_t n) {
+                      for (std::size_t i = 0; i < n; ++i)
+                          bench::do_not_optimize(fixstr::type_hash_v<tagged>);
+                  }));
+}
@@ -25,12 +25,18 @@
 #ifndef FIXED_STRING_HPP
 #define FIXED_STRING_HPP
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <ostream>
+#include <stdexcept>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #define FIXSTR_VERSION_MAJOR 0
 #define FIXSTR_VERSION_MINOR 1
@@ -63,14 +69,84 @@
 #define FIXSTR_CPP20_CNTTP_PRESENT 0
 #endif // FIXSTR_CPP20_CNTTP_PRESENT
 
+#if defined(__cpp_lib_is_constant_evaluated)
+#define FIXSTR_HAS_IS_CONSTANT_EVALUATED 1
+#define FIXSTR_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif FIXSTR_GCC_VERSION >= 90'000 || FIXSTR_CLANG_VERSION >= 90'000 || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define FIXSTR_HAS_IS_CONSTANT_EVALUATED 1
+#define FIXSTR_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+// Without the builtin the portable constexpr code path is used at runtime as well
+#define FIXSTR_HAS_IS_CONSTANT_EVALUATED 0
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FIXSTR_SSE2_PRESENT 1
+#include <emmintrin.h>
+#else
+#define FIXSTR_SSE2_PRESENT 0
+#endif // FIXSTR_SSE2_PRESENT
+
+#if defined(__AVX2__)
+#define FIXSTR_AVX2_PRESENT 1
+#include <immintrin.h>
+#else
+#define FIXSTR_AVX2_PRESENT 0
+#endif // FIXSTR_AVX2_PRESENT
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+
 namespace fixstr
 {
 
 namespace details
 {
+// Constant evaluation limits the iterations of a single loop (262144 by default in GCC) and clang limits the total number of
+// evaluation steps, so long ranges are processed in blocks by nested loops and, where clang can evaluate it, by memmove.
+inline constexpr size_t constant_evaluation_block = 4096;
+
+template <typename InputIterator, typename OutputIterator>
+constexpr bool is_trivial_pointer_copy_v =
+    std::is_pointer_v<InputIterator> && std::is_pointer_v<OutputIterator> &&
+    std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIterator>>, std::remove_pointer_t<OutputIterator>> &&
+    std::is_trivially_copyable_v<std::remove_pointer_t<OutputIterator>>;
+
+template <typename RandomAccessIterator, typename TFunction>
+constexpr void for_each_block(RandomAccessIterator first, RandomAccessIterator last, TFunction f)
+{
+    while (last - first > static_cast<std::ptrdiff_t>(constant_evaluation_block))
+    {
+        f(first, first + static_cast<std::ptrdiff_t>(constant_evaluation_block));
+        first += static_cast<std::ptrdiff_t>(constant_evaluation_block);
+    }
+    f(first, last);
+}
+
 template <typename InputIterator, typename OutputIterator>
 constexpr OutputIterator copy(InputIterator first, InputIterator last, OutputIterator d_first)
 {
+#if FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+    {
+        if (FIXSTR_IS_CONSTANT_EVALUATED())
+        {
+#if defined(__clang__)
+            if constexpr (is_trivial_pointer_copy_v<InputIterator, OutputIterator>)
+            {
+                __builtin_memmove(d_first, first, static_cast<size_t>(last - first) * sizeof(*first));
+                return d_first + (last - first);
+            }
+#endif // defined(__clang__)
+            for_each_block(first, last, [&](InputIterator block_first, InputIterator block_last) {
+                while (block_first != block_last)
+                    *d_first++ = *block_first++;
+            });
+            return d_first;
+        }
+    }
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
 #if FIXSTR_CPP20_CONSTEXPR_ALGORITHMS_PRESENT
     return std::copy(first, last, d_first);
 #else
@@ -85,6 +161,19 @@ constexpr OutputIterator copy(InputIterator first, InputIterator last, OutputIte
 template <typename ForwardIterator, typename T>
 constexpr void fill(ForwardIterator first, ForwardIterator last, const T& value)
 {
+#if FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<ForwardIterator>::iterator_category>)
+    {
+        if (FIXSTR_IS_CONSTANT_EVALUATED())
+        {
+            for_each_block(first, last, [&](ForwardIterator block_first, ForwardIterator block_last) {
+                for (; block_first != block_last; ++block_first)
+                    *block_first = value;
+            });
+            return;
+        }
+    }
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
 #if FIXSTR_CPP20_CONSTEXPR_ALGORITHMS_PRESENT
     std::fill(first, last, value);
 #else
@@ -95,15 +184,79 @@ constexpr void fill(ForwardIterator first, ForwardIterator last, const T& value)
 #endif // FIXSTR_CPP20_CONSTEXPR_ALGORITHMS_PRESENT
 }
 
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool little_endian = false;
+#else
+constexpr bool little_endian = true;
+#endif
+
+constexpr std::uint64_t byteswap(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#else
+    std::uint64_t result = 0;
+    for (size_t i = 0; i < sizeof(value); ++i)
+    {
+        result = (result << 8) | (value & 0xff);
+        value >>= 8;
+    }
+    return result;
+#endif // defined(__GNUC__) || defined(__clang__)
+}
+
 } // namespace details
 
+// Storage policies of basic_fixed_string.
+// `capacity` is the number of stored characters, `alignment` the minimal alignment of the storage in bytes.
+
+// N characters followed by a terminating null character, aligned as the characters are
+struct null_terminated
+{
+    template <typename TChar, size_t N>
+    static constexpr size_t capacity = N + 1;
+    static constexpr size_t alignment = 1;
+    static constexpr bool   terminated = true;
+    static constexpr bool   padded = false;
+};
+
+// N characters followed by null characters up to a multiple of `Alignment` bytes, aligned to `Alignment`.
+// The tail is always zero, so equality and ordering of strings of the same size compare whole padded blocks.
+template <size_t Alignment>
+struct aligned
+{
+    static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "alignment must be a power of two");
+
+    template <typename TChar, size_t N>
+    static constexpr size_t capacity = ((N + 1) * sizeof(TChar) + Alignment - 1) / Alignment * Alignment / sizeof(TChar);
+    static constexpr size_t alignment = Alignment;
+    static constexpr bool   terminated = true;
+    static constexpr bool   padded = true;
+};
+
+// Exactly N characters, for fixed-width records; c_str() is not available
+struct unterminated
+{
+    template <typename TChar, size_t N>
+    static constexpr size_t capacity = N;
+    static constexpr size_t alignment = 1;
+    static constexpr bool   terminated = false;
+    static constexpr bool   padded = false;
+};
+
 template <typename TChar, std::size_t N, typename TTraits = std::char_traits<TChar>>
+class basic_fixed_string_view;
+
+template <typename TChar, std::size_t N, typename TTraits = std::char_traits<TChar>, typename TStorage = null_terminated>
 struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
 {
+    static_assert(TStorage::alignment % sizeof(TChar) == 0 || TStorage::alignment == 1, "alignment must be a multiple of the character size");
+
     // exposition only
-    using storage_type = std::array<TChar, N + 1>;
-    storage_type _data{};
+    using storage_type = std::array<TChar, TStorage::template capacity<TChar, N>>;
+    alignas(std::max(TStorage::alignment, alignof(storage_type))) storage_type _data{};
 
+    using storage_policy = TStorage;
     using traits_type = TTraits;
     using value_type = TChar;
     using pointer = value_type*;
@@ -119,31 +272,49 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     using string_view_type = std::basic_string_view<value_type, traits_type>;
     static constexpr auto npos = string_view_type::npos;
 
+  private:
+    // The terminating null character of the source array is copied unless the storage has no room for it
+    static constexpr size_t copied_size = TStorage::terminated ? N + 1 : N;
+
+  public:
     constexpr basic_fixed_string() noexcept = default;
 
     constexpr basic_fixed_string(const value_type (&array)[N + 1]) noexcept // NOLINT(google-explicit-constructor)
     {
-        details::copy(std::begin(array), std::end(array), _data.begin());
+        details::copy(std::begin(array), std::begin(array) + copied_size, _data.begin());
+    }
+
+    // Conversion between storage policies
+    template <typename TOtherStorage, typename = std::enable_if_t<!std::is_same_v<TOtherStorage, TStorage>>>
+    constexpr explicit basic_fixed_string(const basic_fixed_string<value_type, N, traits_type, TOtherStorage>& other) noexcept
+    {
+        details::copy(other.begin(), other.end(), _data.begin());
+    }
+
+    // Copies the characters of a view
+    constexpr explicit basic_fixed_string(const basic_fixed_string_view<value_type, N, traits_type>& view) noexcept
+    {
+        details::copy(view.begin(), view.end(), _data.begin());
     }
 
     constexpr basic_fixed_string& operator=(const value_type (&array)[N + 1]) noexcept
     {
-        details::copy(std::begin(array), std::end(array), _data.begin());
+        details::copy(std::begin(array), std::begin(array) + copied_size, _data.begin());
         return *this;
     }
 
     // iterators
     [[nodiscard]] constexpr iterator               begin() noexcept { return _data.begin(); }
     [[nodiscard]] constexpr const_iterator         begin() const noexcept { return _data.begin(); }
-    [[nodiscard]] constexpr iterator               end() noexcept { return _data.end() - 1; }
-    [[nodiscard]] constexpr const_iterator         end() const noexcept { return _data.end() - 1; }
+    [[nodiscard]] constexpr iterator               end() noexcept { return _data.begin() + N; }
+    [[nodiscard]] constexpr const_iterator         end() const noexcept { return _data.begin() + N; }
     [[nodiscard]] constexpr const_iterator         cbegin() const noexcept { return _data.cbegin(); }
-    [[nodiscard]] constexpr const_iterator         cend() const noexcept { return _data.cend() - 1; }
-    [[nodiscard]] constexpr reverse_iterator       rbegin() noexcept { return _data.rbegin() + 1; }
-    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return _data.rbegin() + 1; }
+    [[nodiscard]] constexpr const_iterator         cend() const noexcept { return _data.cbegin() + N; }
+    [[nodiscard]] constexpr reverse_iterator       rbegin() noexcept { return reverse_iterator(end()); }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
     [[nodiscard]] constexpr reverse_iterator       rend() noexcept { return _data.rend(); }
     [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return _data.rend(); }
-    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return _data.crbegin() + 1; }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
     [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return _data.crend(); }
 
   private:
@@ -188,11 +359,15 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     [[nodiscard]] constexpr pointer       data() noexcept { return _data.data(); }
     [[nodiscard]] constexpr const_pointer data() const noexcept { return _data.data(); }
 
-    [[nodiscard]] constexpr const_pointer c_str() const noexcept { return data(); }
+    template <typename..., bool Terminated = TStorage::terminated, typename = std::enable_if_t<Terminated>>
+    [[nodiscard]] constexpr const_pointer c_str() const noexcept
+    {
+        return data();
+    }
 
   private:
     template <size_t M>
-    using same_with_other_size = basic_fixed_string<value_type, M, traits_type>;
+    using same_with_other_size = basic_fixed_string<value_type, M, traits_type, TStorage>;
 
     template <size_type pos, size_type count, size_type size>
     constexpr static size_type calculate_substr_size()
@@ -232,21 +407,26 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     {
         if constexpr (M > N)
             return npos;
-        return sv().find(str.sv(), pos);
+        return sv().find(string_view_type(str), pos);
     }
-    [[nodiscard]] constexpr size_type find(string_view_type sv, size_type pos = 0) const noexcept { return sv().find(sv, pos); }
+    [[nodiscard]] constexpr size_type find(string_view_type v, size_type pos = 0) const noexcept { return sv().find(v, pos); }
     [[nodiscard]] constexpr size_type find(const value_type* s, size_type pos, size_type n) const { return sv().find(s, pos, n); }
     [[nodiscard]] constexpr size_type find(const value_type* s, size_type pos = 0) const { return sv().find(s, pos); }
     [[nodiscard]] constexpr size_type find(value_type c, size_type pos = 0) const noexcept { return sv().find(c, pos); }
+#if FIXSTR_CPP20_CNTTP_PRESENT
+    // Searches with `fixstr::searcher`, which precomputes everything about the needle at compile time
+    template <::fixstr::basic_fixed_string Needle>
+    [[nodiscard]] constexpr size_type find(size_type pos = 0) const noexcept;
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
 
     template <size_t M>
     [[nodiscard]] constexpr size_type rfind(const same_with_other_size<M>& str, size_type pos = npos) const noexcept
     {
         if constexpr (M > N)
             return npos;
-        return sv().rfind(str.sv(), pos);
+        return sv().rfind(string_view_type(str), pos);
     }
-    [[nodiscard]] constexpr size_type rfind(string_view_type sv, size_type pos = npos) const noexcept { return sv().rfind(sv, pos); }
+    [[nodiscard]] constexpr size_type rfind(string_view_type v, size_type pos = npos) const noexcept { return sv().rfind(v, pos); }
     [[nodiscard]] constexpr size_type rfind(const value_type* s, size_type pos, size_type n) const { return sv().rfind(s, pos, n); }
     [[nodiscard]] constexpr size_type rfind(const value_type* s, size_type pos = npos) const { return sv().rfind(s, pos); }
     [[nodiscard]] constexpr size_type rfind(value_type c, size_type pos = npos) const noexcept { return sv().rfind(c, pos); }
@@ -254,11 +434,9 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     template <size_t M>
     [[nodiscard]] constexpr size_type find_first_of(const same_with_other_size<M>& str, size_type pos = 0) const noexcept
     {
-        if constexpr (M > N)
-            return npos;
-        return sv().find_first_of(str.sv(), pos);
+        return sv().find_first_of(string_view_type(str), pos);
     }
-    [[nodiscard]] constexpr size_type find_first_of(string_view_type sv, size_type pos = 0) const noexcept { return sv().find_first_of(sv, pos); }
+    [[nodiscard]] constexpr size_type find_first_of(string_view_type v, size_type pos = 0) const noexcept { return sv().find_first_of(v, pos); }
     [[nodiscard]] constexpr size_type find_first_of(const value_type* s, size_type pos, size_type n) const { return sv().find_first_of(s, pos, n); }
     [[nodiscard]] constexpr size_type find_first_of(const value_type* s, size_type pos = 0) const { return sv().find_first_of(s, pos); }
     [[nodiscard]] constexpr size_type find_first_of(value_type c, size_type pos = 0) const noexcept { return sv().find_first_of(c, pos); }
@@ -266,11 +444,9 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     template <size_t M>
     [[nodiscard]] constexpr size_type find_last_of(const same_with_other_size<M>& str, size_type pos = npos) const noexcept
     {
-        if constexpr (M > N)
-            return npos;
-        return sv().find_last_of(str.sv(), pos);
+        return sv().find_last_of(string_view_type(str), pos);
     }
-    [[nodiscard]] constexpr size_type find_last_of(string_view_type sv, size_type pos = npos) const noexcept { return sv().find_last_of(sv, pos); }
+    [[nodiscard]] constexpr size_type find_last_of(string_view_type v, size_type pos = npos) const noexcept { return sv().find_last_of(v, pos); }
     [[nodiscard]] constexpr size_type find_last_of(const value_type* s, size_type pos, size_type n) const { return sv().find_last_of(s, pos, n); }
     [[nodiscard]] constexpr size_type find_last_of(const value_type* s, size_type pos = npos) const { return sv().find_last_of(s, pos); }
     [[nodiscard]] constexpr size_type find_last_of(value_type c, size_type pos = npos) const noexcept { return sv().find_last_of(c, pos); }
@@ -278,11 +454,9 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     template <size_t M>
     [[nodiscard]] constexpr size_type find_first_not_of(const same_with_other_size<M>& str, size_type pos = 0) const noexcept
     {
-        if constexpr (M > N)
-            return npos;
-        return sv().find_first_of(str.sv(), pos);
+        return sv().find_first_not_of(string_view_type(str), pos);
     }
-    [[nodiscard]] constexpr size_type find_first_not_of(string_view_type sv, size_type pos = 0) const noexcept { return sv().find_first_not_of(sv, pos); }
+    [[nodiscard]] constexpr size_type find_first_not_of(string_view_type v, size_type pos = 0) const noexcept { return sv().find_first_not_of(v, pos); }
     [[nodiscard]] constexpr size_type find_first_not_of(const value_type* s, size_type pos, size_type n) const { return sv().find_first_not_of(s, pos, n); }
     [[nodiscard]] constexpr size_type find_first_not_of(const value_type* s, size_type pos = 0) const { return sv().find_first_not_of(s, pos); }
     [[nodiscard]] constexpr size_type find_first_not_of(value_type c, size_type pos = 0) const noexcept { return sv().find_first_not_of(c, pos); }
@@ -290,11 +464,9 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     template <size_t M>
     [[nodiscard]] constexpr size_type find_last_not_of(const same_with_other_size<M>& str, size_type pos = npos) const noexcept
     {
-        if constexpr (M > N)
-            return npos;
-        return sv().find_last_of(str.sv(), pos);
+        return sv().find_last_not_of(string_view_type(str), pos);
     }
-    [[nodiscard]] constexpr size_type find_last_not_of(string_view_type sv, size_type pos = npos) const noexcept { return sv().find_last_not_of(sv, pos); }
+    [[nodiscard]] constexpr size_type find_last_not_of(string_view_type v, size_type pos = npos) const noexcept { return sv().find_last_not_of(v, pos); }
     [[nodiscard]] constexpr size_type find_last_not_of(const value_type* s, size_type pos, size_type n) const { return sv().find_last_not_of(s, pos, n); }
     [[nodiscard]] constexpr size_type find_last_not_of(const value_type* s, size_type pos = npos) const { return sv().find_last_not_of(s, pos); }
     [[nodiscard]] constexpr size_type find_last_not_of(value_type c, size_type pos = npos) const noexcept { return sv().find_last_not_of(c, pos); }
@@ -323,6 +495,10 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     [[nodiscard]] constexpr bool contains(string_view_type sv) const noexcept { return find(sv) != npos; }
     [[nodiscard]] constexpr bool contains(value_type c) const noexcept { return find(c) != npos; }
     [[nodiscard]] constexpr bool contains(const value_type* s) const { return find(s) != npos; }
+#if FIXSTR_CPP20_CNTTP_PRESENT
+    template <::fixstr::basic_fixed_string Needle>
+    [[nodiscard]] constexpr bool contains() const noexcept;
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
 
     void swap(basic_fixed_string& other) noexcept(std::is_nothrow_swappable_v<storage_type>) { _data.swap(other._data); }
 
@@ -330,32 +506,260 @@ struct basic_fixed_string // NOLINT(cppcoreguidelines-special-member-functions)
     constexpr string_view_type sv() const { return *this; }
 };
 
-template <typename TChar, typename TTraits, size_t N>
-void swap(basic_fixed_string<TChar, N, TTraits>& lhs, basic_fixed_string<TChar, N, TTraits>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+void swap(basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, basic_fixed_string<TChar, N, TTraits, TStorage>& rhs) noexcept(noexcept(lhs.swap(rhs)))
 {
     lhs.swap(rhs);
 }
 
-template <typename TChar, typename TTraits, size_t M1, size_t M2>
-[[nodiscard]] constexpr bool operator==(const basic_fixed_string<TChar, M1, TTraits>& lhs, const basic_fixed_string<TChar, M2, TTraits>& rhs)
+namespace details::kernels
+{
+template <typename T>
+T load(const unsigned char* p) noexcept
+{
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+// Loads an integer whose ordering matches the lexicographical ordering of the loaded bytes
+template <typename T>
+T load_big_endian(const unsigned char* p) noexcept
+{
+    const auto value = load<T>(p);
+    if constexpr (!little_endian)
+        return value;
+    else if constexpr (sizeof(T) == 8)
+        return byteswap(value);
+    else
+        return static_cast<T>(byteswap(value) >> (64 - 8 * sizeof(T)));
+}
+
+inline unsigned count_trailing_zeros(unsigned value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(value));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned count = 0;
+    while ((value & 1) == 0)
+    {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+template <typename T>
+int three_way(T lhs, T rhs) noexcept
+{
+    return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+}
+
+// Bit `i` of the result is set when byte `i` of the blocks differs
+#if FIXSTR_AVX2_PRESENT
+inline unsigned mismatch_mask_32(const unsigned char* lhs, const unsigned char* rhs) noexcept
+{
+    const auto l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs));
+    const auto r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs));
+    return ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r)));
+}
+#endif // FIXSTR_AVX2_PRESENT
+
+#if FIXSTR_SSE2_PRESENT
+inline unsigned mismatch_mask_16(const unsigned char* lhs, const unsigned char* rhs) noexcept
+{
+    const auto l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs));
+    const auto r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(l, r))) ^ 0xffffu;
+}
+#endif // FIXSTR_SSE2_PRESENT
+
+// Blocks of `Block` bytes covering [0, Bytes), the last one overlaps its predecessor when Bytes is not a multiple of Block.
+// Returns the offset of the first differing byte or Bytes.
+template <size_t Bytes, size_t Block, typename MismatchMask>
+size_t mismatch_blocks(const unsigned char* lhs, const unsigned char* rhs, MismatchMask mismatch_mask) noexcept
+{
+    static_assert(Bytes >= Block);
+    size_t offset = 0;
+    for (; offset + Block <= Bytes; offset += Block)
+    {
+        if (const unsigned mask = mismatch_mask(lhs + offset, rhs + offset))
+            return offset + count_trailing_zeros(mask);
+    }
+    if constexpr (Bytes % Block != 0)
+    {
+        if (const unsigned mask = mismatch_mask(lhs + Bytes - Block, rhs + Bytes - Block))
+            return Bytes - Block + count_trailing_zeros(mask);
+    }
+    return Bytes;
+}
+
+template <size_t Bytes>
+size_t mismatch(const unsigned char* lhs, const unsigned char* rhs) noexcept
+{
+#if FIXSTR_AVX2_PRESENT
+    if constexpr (Bytes >= 32)
+        return mismatch_blocks<Bytes, 32>(lhs, rhs, mismatch_mask_32);
+    else
+#endif // FIXSTR_AVX2_PRESENT
+#if FIXSTR_SSE2_PRESENT
+        return mismatch_blocks<Bytes, 16>(lhs, rhs, mismatch_mask_16);
+#else
+        return mismatch_blocks<Bytes, 8>(lhs, rhs, [](const unsigned char* l, const unsigned char* r) {
+            const auto diff = load<std::uint64_t>(l) ^ load<std::uint64_t>(r);
+            unsigned   mask = 0;
+            for (unsigned i = 0; i < 8; ++i)
+                mask |= ((little_endian ? diff >> (8 * i) : diff >> (56 - 8 * i)) & 0xff) != 0 ? 1u << i : 0u;
+            return mask;
+        });
+#endif // FIXSTR_SSE2_PRESENT
+}
+
+// Up to 16 bytes are compared with two possibly overlapping loads of the widest fitting integer type
+template <size_t Bytes>
+bool equal(const unsigned char* lhs, const unsigned char* rhs) noexcept
+{
+    if constexpr (Bytes == 0)
+        return true;
+    else if constexpr (Bytes == 1)
+        return *lhs == *rhs;
+    else if constexpr (Bytes <= 16)
+    {
+        using word = std::conditional_t<(Bytes >= 8), std::uint64_t, std::conditional_t<(Bytes >= 4), std::uint32_t, std::uint16_t>>;
+        constexpr size_t last = Bytes - sizeof(word);
+        return ((load<word>(lhs) ^ load<word>(rhs)) | (load<word>(lhs + last) ^ load<word>(rhs + last))) == 0;
+    }
+    else
+    {
+#if FIXSTR_SSE2_PRESENT
+        // Equality does not need the position of the mismatch, so block results are accumulated and tested once per 64 bytes
+        auto acc = _mm_set1_epi8(-1);
+        for (size_t offset = 0; offset + 16 <= Bytes; offset += 16)
+        {
+            const auto l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + offset));
+            const auto r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + offset));
+            acc = _mm_and_si128(acc, _mm_cmpeq_epi8(l, r));
+            if (offset % 64 == 48 && _mm_movemask_epi8(acc) != 0xffff)
+                return false;
+        }
+        if constexpr (Bytes % 16 != 0)
+        {
+            const auto l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + Bytes - 16));
+            const auto r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + Bytes - 16));
+            acc = _mm_and_si128(acc, _mm_cmpeq_epi8(l, r));
+        }
+        return _mm_movemask_epi8(acc) == 0xffff;
+#else
+        return mismatch<Bytes>(lhs, rhs) == Bytes;
+#endif // FIXSTR_SSE2_PRESENT
+    }
+}
+
+template <size_t Bytes>
+int compare(const unsigned char* lhs, const unsigned char* rhs) noexcept
+{
+    if constexpr (Bytes == 0)
+        return 0;
+    else if constexpr (Bytes == 1)
+        return three_way(*lhs, *rhs);
+    else if constexpr (Bytes <= 16)
+    {
+        using word = std::conditional_t<(Bytes >= 8), std::uint64_t, std::conditional_t<(Bytes >= 4), std::uint32_t, std::uint16_t>>;
+        constexpr size_t last = Bytes - sizeof(word);
+        const auto       l = load_big_endian<word>(lhs);
+        const auto       r = load_big_endian<word>(rhs);
+        if (l != r)
+            return three_way(l, r);
+        return three_way(load_big_endian<word>(lhs + last), load_big_endian<word>(rhs + last));
+    }
+    else
+    {
+        const size_t offset = mismatch<Bytes>(lhs, rhs);
+        return offset == Bytes ? 0 : three_way(lhs[offset], rhs[offset]);
+    }
+}
+} // namespace details::kernels
+
+namespace details
+{
+// Number of characters the runtime kernels compare for two strings of size N. When both sides are padded alike, the zeroed
+// tail takes part in comparisons: sizes are rounded up to a single load of up to 16 bytes or to whole 16-byte blocks, so the
+// kernels never need an overlapping load for the remainder.
+template <typename TChar, size_t N, typename TStorage1, typename TStorage2>
+constexpr size_t compared_size() noexcept
+{
+    if constexpr (!std::is_same_v<TStorage1, TStorage2> || !TStorage1::padded)
+        return N;
+    else
+    {
+        constexpr size_t bytes = N * sizeof(TChar);
+        size_t           rounded = 1;
+        while (rounded < bytes && rounded < 16)
+            rounded *= 2;
+        if (bytes > 16)
+            rounded = (bytes + 15) / 16 * 16;
+        return rounded <= TStorage1::template capacity<TChar, N> * sizeof(TChar) ? rounded / sizeof(TChar) : N;
+    }
+}
+
+template <typename TChar, size_t N, typename TStorage1, typename TStorage2>
+constexpr size_t compared_size_v = compared_size<TChar, N, TStorage1, TStorage2>();
+
+// Equality of two strings of the same compile-time size.
+// Standard character traits compare characters bitwise, so the runtime path compares raw bytes.
+template <typename TChar, typename TTraits, size_t N, size_t Compared = N>
+constexpr bool fixed_equal(const TChar* lhs, const TChar* rhs) noexcept
+{
+#if FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    if constexpr (std::is_same_v<TTraits, std::char_traits<TChar>>)
+    {
+        if (!FIXSTR_IS_CONSTANT_EVALUATED())
+            return kernels::equal<Compared * sizeof(TChar)>(reinterpret_cast<const unsigned char*>(lhs), reinterpret_cast<const unsigned char*>(rhs));
+    }
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    return TTraits::compare(lhs, rhs, N) == 0;
+}
+
+// Three-way comparison of two strings of the same compile-time size.
+// Standard traits of single-byte characters order them as unsigned bytes, which is the order of big-endian words.
+template <typename TChar, typename TTraits, size_t N, size_t Compared = N>
+constexpr int fixed_compare(const TChar* lhs, const TChar* rhs) noexcept
+{
+#if FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    if constexpr (sizeof(TChar) == 1 && std::is_same_v<TTraits, std::char_traits<TChar>>)
+    {
+        if (!FIXSTR_IS_CONSTANT_EVALUATED())
+            return kernels::compare<Compared>(reinterpret_cast<const unsigned char*>(lhs), reinterpret_cast<const unsigned char*>(rhs));
+    }
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    return TTraits::compare(lhs, rhs, N);
+}
+} // namespace details
+
+template <typename TChar, typename TTraits, size_t M1, size_t M2, typename TStorage1, typename TStorage2>
+[[nodiscard]] constexpr bool operator==(const basic_fixed_string<TChar, M1, TTraits, TStorage1>& lhs, const basic_fixed_string<TChar, M2, TTraits, TStorage2>& rhs)
 {
     if constexpr (M1 != M2)
         return false;
-    using lhs_type = std::decay_t<decltype(lhs)>;
-    using sv_type = typename lhs_type::string_view_type;
-    return static_cast<sv_type>(lhs) == rhs;
+    else
+        return details::fixed_equal<TChar, TTraits, M1, details::compared_size_v<TChar, M1, TStorage1, TStorage2>>(lhs.data(), rhs.data());
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator==(const basic_fixed_string<TChar, N, TTraits>& lhs, std::basic_string_view<TChar, TTraits> rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator==(const basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, std::basic_string_view<TChar, TTraits> rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
     return static_cast<sv_type>(lhs) == rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator==(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator==(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits, TStorage>& rhs)
 {
     using rhs_type = std::decay_t<decltype(rhs)>;
     using sv_type = typename rhs_type::string_view_type;
@@ -364,24 +768,28 @@ template <typename TChar, typename TTraits, size_t N>
 
 #if FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
 
-template <typename TChar, typename TTraits, size_t M1, size_t M2>
-[[nodiscard]] constexpr auto operator<=>(const basic_fixed_string<TChar, M1, TTraits>& lhs, const basic_fixed_string<TChar, M2, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t M1, size_t M2, typename TStorage1, typename TStorage2>
+[[nodiscard]] constexpr auto operator<=>(const basic_fixed_string<TChar, M1, TTraits, TStorage1>& lhs, const basic_fixed_string<TChar, M2, TTraits, TStorage2>& rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
-    return static_cast<sv_type>(lhs) <=> rhs;
+    using result_type = decltype(std::declval<sv_type>() <=> std::declval<sv_type>());
+    if constexpr (M1 == M2)
+        return static_cast<result_type>(details::fixed_compare<TChar, TTraits, M1, details::compared_size_v<TChar, M1, TStorage1, TStorage2>>(lhs.data(), rhs.data()) <=> 0);
+    else
+        return static_cast<sv_type>(lhs) <=> rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr auto operator<=>(const basic_fixed_string<TChar, N, TTraits>& lhs, std::basic_string_view<TChar, TTraits> rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr auto operator<=>(const basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, std::basic_string_view<TChar, TTraits> rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
     return static_cast<sv_type>(lhs) <=> rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr auto operator<=>(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr auto operator<=>(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits, TStorage>& rhs)
 {
     using rhs_type = std::decay_t<decltype(rhs)>;
     using sv_type = typename rhs_type::string_view_type;
@@ -390,122 +798,133 @@ template <typename TChar, typename TTraits, size_t N>
 
 #else
 
-template <typename TChar, typename TTraits, size_t M1, size_t M2>
-[[nodiscard]] constexpr bool operator!=(const basic_fixed_string<TChar, M1, TTraits>& lhs, const basic_fixed_string<TChar, M2, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t M1, size_t M2, typename TStorage1, typename TStorage2>
+[[nodiscard]] constexpr bool operator!=(const basic_fixed_string<TChar, M1, TTraits, TStorage1>& lhs, const basic_fixed_string<TChar, M2, TTraits, TStorage2>& rhs)
 {
     if constexpr (M1 != M2)
         return true;
-    using lhs_type = std::decay_t<decltype(lhs)>;
-    using sv_type = typename lhs_type::string_view_type;
-    return static_cast<sv_type>(lhs) != rhs;
+    else
+        return !details::fixed_equal<TChar, TTraits, M1, details::compared_size_v<TChar, M1, TStorage1, TStorage2>>(lhs.data(), rhs.data());
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator!=(const basic_fixed_string<TChar, N, TTraits>& lhs, std::basic_string_view<TChar, TTraits> rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator!=(const basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, std::basic_string_view<TChar, TTraits> rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
     return static_cast<sv_type>(lhs) != rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator!=(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator!=(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits, TStorage>& rhs)
 {
     using rhs_type = std::decay_t<decltype(rhs)>;
     using sv_type = typename rhs_type::string_view_type;
     return lhs != static_cast<sv_type>(rhs);
 }
 
-template <typename TChar, typename TTraits, size_t M1, size_t M2>
-[[nodiscard]] constexpr bool operator<(const basic_fixed_string<TChar, M1, TTraits>& lhs, const basic_fixed_string<TChar, M2, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t M1, size_t M2, typename TStorage1, typename TStorage2>
+[[nodiscard]] constexpr bool operator<(const basic_fixed_string<TChar, M1, TTraits, TStorage1>& lhs, const basic_fixed_string<TChar, M2, TTraits, TStorage2>& rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
-    return static_cast<sv_type>(lhs) < rhs;
+    if constexpr (M1 == M2)
+        return details::fixed_compare<TChar, TTraits, M1, details::compared_size_v<TChar, M1, TStorage1, TStorage2>>(lhs.data(), rhs.data()) < 0;
+    else
+        return static_cast<sv_type>(lhs) < rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator<(const basic_fixed_string<TChar, N, TTraits>& lhs, std::basic_string_view<TChar, TTraits> rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator<(const basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, std::basic_string_view<TChar, TTraits> rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
     return static_cast<sv_type>(lhs) < rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator<(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator<(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits, TStorage>& rhs)
 {
     using rhs_type = std::decay_t<decltype(rhs)>;
     using sv_type = typename rhs_type::string_view_type;
     return lhs < static_cast<sv_type>(rhs);
 }
 
-template <typename TChar, typename TTraits, size_t M1, size_t M2>
-[[nodiscard]] constexpr bool operator<=(const basic_fixed_string<TChar, M1, TTraits>& lhs, const basic_fixed_string<TChar, M2, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t M1, size_t M2, typename TStorage1, typename TStorage2>
+[[nodiscard]] constexpr bool operator<=(const basic_fixed_string<TChar, M1, TTraits, TStorage1>& lhs, const basic_fixed_string<TChar, M2, TTraits, TStorage2>& rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
-    return static_cast<sv_type>(lhs) <= rhs;
+    if constexpr (M1 == M2)
+        return details::fixed_compare<TChar, TTraits, M1, details::compared_size_v<TChar, M1, TStorage1, TStorage2>>(lhs.data(), rhs.data()) <= 0;
+    else
+        return static_cast<sv_type>(lhs) <= rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator<=(const basic_fixed_string<TChar, N, TTraits>& lhs, std::basic_string_view<TChar, TTraits> rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator<=(const basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, std::basic_string_view<TChar, TTraits> rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
     return static_cast<sv_type>(lhs) <= rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator<=(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator<=(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits, TStorage>& rhs)
 {
     using rhs_type = std::decay_t<decltype(rhs)>;
     using sv_type = typename rhs_type::string_view_type;
     return lhs <= static_cast<sv_type>(rhs);
 }
 
-template <typename TChar, typename TTraits, size_t M1, size_t M2>
-[[nodiscard]] constexpr bool operator>(const basic_fixed_string<TChar, M1, TTraits>& lhs, const basic_fixed_string<TChar, M2, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t M1, size_t M2, typename TStorage1, typename TStorage2>
+[[nodiscard]] constexpr bool operator>(const basic_fixed_string<TChar, M1, TTraits, TStorage1>& lhs, const basic_fixed_string<TChar, M2, TTraits, TStorage2>& rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
-    return static_cast<sv_type>(lhs) > rhs;
+    if constexpr (M1 == M2)
+        return details::fixed_compare<TChar, TTraits, M1, details::compared_size_v<TChar, M1, TStorage1, TStorage2>>(lhs.data(), rhs.data()) > 0;
+    else
+        return static_cast<sv_type>(lhs) > rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator>(const basic_fixed_string<TChar, N, TTraits>& lhs, std::basic_string_view<TChar, TTraits> rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator>(const basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, std::basic_string_view<TChar, TTraits> rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
     return static_cast<sv_type>(lhs) > rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator>(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator>(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits, TStorage>& rhs)
 {
     using rhs_type = std::decay_t<decltype(rhs)>;
     using sv_type = typename rhs_type::string_view_type;
     return lhs > static_cast<sv_type>(rhs);
 }
 
-template <typename TChar, typename TTraits, size_t M1, size_t M2>
-[[nodiscard]] constexpr bool operator>=(const basic_fixed_string<TChar, M1, TTraits>& lhs, const basic_fixed_string<TChar, M2, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t M1, size_t M2, typename TStorage1, typename TStorage2>
+[[nodiscard]] constexpr bool operator>=(const basic_fixed_string<TChar, M1, TTraits, TStorage1>& lhs, const basic_fixed_string<TChar, M2, TTraits, TStorage2>& rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
-    return static_cast<sv_type>(lhs) >= rhs;
+    if constexpr (M1 == M2)
+        return details::fixed_compare<TChar, TTraits, M1, details::compared_size_v<TChar, M1, TStorage1, TStorage2>>(lhs.data(), rhs.data()) >= 0;
+    else
+        return static_cast<sv_type>(lhs) >= rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator>=(const basic_fixed_string<TChar, N, TTraits>& lhs, std::basic_string_view<TChar, TTraits> rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator>=(const basic_fixed_string<TChar, N, TTraits, TStorage>& lhs, std::basic_string_view<TChar, TTraits> rhs)
 {
     using lhs_type = std::decay_t<decltype(lhs)>;
     using sv_type = typename lhs_type::string_view_type;
     return static_cast<sv_type>(lhs) >= rhs;
 }
 
-template <typename TChar, typename TTraits, size_t N>
-[[nodiscard]] constexpr bool operator>=(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+template <typename TChar, typename TTraits, size_t N, typename TStorage>
+[[nodiscard]] constexpr bool operator>=(std::basic_string_view<TChar, TTraits> lhs, const basic_fixed_string<TChar, N, TTraits, TStorage>& rhs)
 {
     using rhs_type = std::decay_t<decltype(rhs)>;
     using sv_type = typename rhs_type::string_view_type;
@@ -562,119 +981,1255 @@ struct fixed_wstring : basic_fixed_string<wchar_t, N>
 template <std::size_t N>
 fixed_wstring(const wchar_t (&)[N]) -> fixed_wstring<N - 1>;
 
-template <typename TChar, size_t N, size_t M, typename TTraits>
-constexpr basic_fixed_string<TChar, N + M, TTraits> operator+(const basic_fixed_string<TChar, N, TTraits>& lhs, const basic_fixed_string<TChar, M, TTraits>& rhs)
+// A view of N characters stored elsewhere, such as a field of a fixed-width record parsed in place.
+// The size is a compile-time constant, so comparisons with views and fixed strings of the same size and hashing use the same
+// fixed-size kernels as basic_fixed_string, and substrings are views as well. The characters must outlive the view and are
+// not required to be null-terminated.
+template <typename TChar, std::size_t N, typename TTraits>
+class basic_fixed_string_view
 {
-    basic_fixed_string<TChar, N + M, TTraits> result;
-    details::copy(lhs.begin(), lhs.end(), result.begin());
-    details::copy(rhs.begin(), rhs.end(), result.begin() + N);
-    return result;
-}
+  public:
+    using traits_type = TTraits;
+    using value_type = TChar;
+    using pointer = const value_type*;
+    using const_pointer = const value_type*;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+    using iterator = const_pointer;
+    using const_iterator = const_pointer;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = reverse_iterator;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using string_view_type = std::basic_string_view<value_type, traits_type>;
+    static constexpr auto npos = string_view_type::npos;
 
-template <typename TChar, size_t N, size_t M, typename TTraits>
-constexpr basic_fixed_string<TChar, N - 1 + M, TTraits> operator+(const TChar (&lhs)[N], const basic_fixed_string<TChar, M, TTraits>& rhs)
-{
-    basic_fixed_string lhs2 = lhs;
-    return lhs2 + rhs;
-}
+    constexpr basic_fixed_string_view() noexcept = default;
 
-template <typename TChar, size_t N, size_t M, typename TTraits>
-constexpr basic_fixed_string<TChar, N + M - 1, TTraits> operator+(const basic_fixed_string<TChar, N, TTraits>& lhs, const TChar (&rhs)[M])
-{
-    basic_fixed_string rhs2 = rhs;
-    return lhs + rhs2;
-}
+    constexpr explicit basic_fixed_string_view(const_pointer data) noexcept : _data(data) {}
 
-namespace details
-{
-template <typename TChar>
-constexpr basic_fixed_string<TChar, 1> from_char(TChar ch)
-{
-    basic_fixed_string<TChar, 1> fs;
-    fs[0] = ch;
-    return fs;
-}
-} // namespace details
+    template <typename TStorage>
+    constexpr basic_fixed_string_view(const basic_fixed_string<value_type, N, traits_type, TStorage>& str) noexcept // NOLINT(google-explicit-constructor)
+        : _data(str.data())
+    {
+    }
 
-template <typename TChar, size_t N, typename TTraits>
-constexpr basic_fixed_string<TChar, N + 1, TTraits> operator+(TChar lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
-{
-    return details::from_char(lhs) + rhs;
-}
+    // Throws std::length_error unless `sv` has exactly N characters
+    constexpr explicit basic_fixed_string_view(string_view_type sv)
+        : _data(sv.size() == N ? sv.data() : throw std::length_error("fixstr::basic_fixed_string_view: size mismatch"))
+    {
+    }
 
-template <typename TChar, size_t N, typename TTraits>
-constexpr basic_fixed_string<TChar, N + 1, TTraits> operator+(const basic_fixed_string<TChar, N, TTraits>& lhs, TChar rhs)
-{
-    return lhs + details::from_char(rhs);
-}
+    // iterators
+    [[nodiscard]] constexpr const_iterator         begin() const noexcept { return _data; }
+    [[nodiscard]] constexpr const_iterator         end() const noexcept { return _data + N; }
+    [[nodiscard]] constexpr const_iterator         cbegin() const noexcept { return begin(); }
+    [[nodiscard]] constexpr const_iterator         cend() const noexcept { return end(); }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return rend(); }
 
-template <typename TChar, size_t N, typename TTraits>
-std::basic_ostream<TChar, TTraits>& operator<<(std::basic_ostream<TChar, TTraits>& out, const basic_fixed_string<TChar, N, TTraits>& str)
-{
-    out << str.data();
-    return out;
-}
+  private:
+    [[nodiscard]] constexpr static bool static_empty() noexcept { return N == 0; }
 
-} // namespace fixstr
+  public:
+    // capacity
+    [[nodiscard]] constexpr size_type size() const noexcept { return N; }
+    [[nodiscard]] constexpr size_type length() const noexcept { return N; }
+    [[nodiscard]] constexpr size_type max_size() const noexcept { return N; }
+    [[nodiscard]] constexpr bool      empty() const noexcept { return static_empty(); }
 
-// hash support
-namespace std
-{
-template <size_t N>
-struct hash<fixstr::fixed_string<N>>
-{
-    using argument_type = fixstr::fixed_string<N>;
-    size_t operator()(const argument_type& str) const
+    // element access
+    [[nodiscard]] constexpr const_reference operator[](size_type n) const { return _data[n]; }
+    [[nodiscard]] constexpr const_reference at(size_type n) const
     {
-        using sv_t = typename argument_type::string_view_type;
-        return std::hash<sv_t>()(static_cast<sv_t>(str));
+        return n < N ? _data[n] : throw std::out_of_range("fixstr::basic_fixed_string_view::at: position out of range");
     }
-};
 
-#if FIXSTR_CPP20_CHAR8T_PRESENT
-template <size_t N>
-struct hash<fixstr::fixed_u8string<N>>
-{
-    using argument_type = fixstr::fixed_u8string<N>;
-    size_t operator()(const argument_type& str) const
+    template <typename..., bool NonEmpty = !static_empty(), typename = std::enable_if_t<NonEmpty>>
+    [[nodiscard]] constexpr const_reference front() const noexcept
     {
-        using sv_t = typename argument_type::string_view_type;
-        return std::hash<sv_t>()(static_cast<sv_t>(str));
+        return _data[0];
+    }
+    template <typename..., bool NonEmpty = !static_empty(), typename = std::enable_if_t<NonEmpty>>
+    [[nodiscard]] constexpr const_reference back() const noexcept
+    {
+        return _data[N - 1];
     }
-};
-#endif // FIXSTR_CPP20_CHAR8T_PRESENT
 
-template <size_t N>
-struct hash<fixstr::fixed_u16string<N>>
-{
-    using argument_type = fixstr::fixed_u16string<N>;
-    size_t operator()(const argument_type& str) const
+    [[nodiscard]] constexpr const_pointer data() const noexcept { return _data; }
+
+  private:
+    template <size_type pos, size_type count, size_type size>
+    constexpr static size_type calculate_substr_size()
     {
-        using sv_t = typename argument_type::string_view_type;
-        return std::hash<sv_t>()(static_cast<sv_t>(str));
+        if constexpr (pos >= size)
+            return 0;
+
+        constexpr size_type rcount = std::min(count, size - pos);
+
+        return rcount;
     }
-};
 
-template <size_t N>
-struct hash<fixstr::fixed_u32string<N>>
-{
-    using argument_type = fixstr::fixed_u32string<N>;
-    size_t operator()(const argument_type& str) const
+    template <size_type pos, size_type count>
+    using substr_result_type = basic_fixed_string_view<value_type, calculate_substr_size<pos, count, N>(), traits_type>;
+
+  public:
+    // string operations
+    [[nodiscard]] constexpr operator string_view_type() const noexcept // NOLINT(google-explicit-constructor)
     {
-        using sv_t = typename argument_type::string_view_type;
-        return std::hash<sv_t>()(static_cast<sv_t>(str));
+        return {_data, N};
     }
-};
 
-template <size_t N>
-struct hash<fixstr::fixed_wstring<N>>
-{
-    using argument_type = fixstr::fixed_wstring<N>;
-    size_t operator()(const argument_type& str) const
+    // A view of the characters [pos, pos + count), nothing is copied
+    // clang-format off
+    template <size_type pos = 0, size_type count = npos,
+              typename..., bool IsPosInBounds = pos <= N, typename = std::enable_if_t<IsPosInBounds>>
+    [[nodiscard]] constexpr auto substr() const noexcept
+        -> substr_result_type<pos, count>
+    // clang-format on
     {
-        using sv_t = typename argument_type::string_view_type;
-        return std::hash<sv_t>()(static_cast<sv_t>(str));
+        return substr_result_type<pos, count>(_data + pos);
     }
+
+    [[nodiscard]] constexpr size_type find(string_view_type v, size_type pos = 0) const noexcept { return sv().find(v, pos); }
+    [[nodiscard]] constexpr size_type find(const value_type* s, size_type pos, size_type n) const { return sv().find(s, pos, n); }
+    [[nodiscard]] constexpr size_type find(const value_type* s, size_type pos = 0) const { return sv().find(s, pos); }
+    [[nodiscard]] constexpr size_type find(value_type c, size_type pos = 0) const noexcept { return sv().find(c, pos); }
+#if FIXSTR_CPP20_CNTTP_PRESENT
+    template <::fixstr::basic_fixed_string Needle>
+    [[nodiscard]] constexpr size_type find(size_type pos = 0) const noexcept;
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+    [[nodiscard]] constexpr size_type rfind(string_view_type v, size_type pos = npos) const noexcept { return sv().rfind(v, pos); }
+    [[nodiscard]] constexpr size_type rfind(const value_type* s, size_type pos, size_type n) const { return sv().rfind(s, pos, n); }
+    [[nodiscard]] constexpr size_type rfind(const value_type* s, size_type pos = npos) const { return sv().rfind(s, pos); }
+    [[nodiscard]] constexpr size_type rfind(value_type c, size_type pos = npos) const noexcept { return sv().rfind(c, pos); }
+
+    [[nodiscard]] constexpr size_type find_first_of(string_view_type v, size_type pos = 0) const noexcept { return sv().find_first_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_first_of(const value_type* s, size_type pos, size_type n) const { return sv().find_first_of(s, pos, n); }
+    [[nodiscard]] constexpr size_type find_first_of(const value_type* s, size_type pos = 0) const { return sv().find_first_of(s, pos); }
+    [[nodiscard]] constexpr size_type find_first_of(value_type c, size_type pos = 0) const noexcept { return sv().find_first_of(c, pos); }
+
+    [[nodiscard]] constexpr size_type find_last_of(string_view_type v, size_type pos = npos) const noexcept { return sv().find_last_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_last_of(const value_type* s, size_type pos, size_type n) const { return sv().find_last_of(s, pos, n); }
+    [[nodiscard]] constexpr size_type find_last_of(const value_type* s, size_type pos = npos) const { return sv().find_last_of(s, pos); }
+    [[nodiscard]] constexpr size_type find_last_of(value_type c, size_type pos = npos) const noexcept { return sv().find_last_of(c, pos); }
+
+    [[nodiscard]] constexpr size_type find_first_not_of(string_view_type v, size_type pos = 0) const noexcept { return sv().find_first_not_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_first_not_of(const value_type* s, size_type pos, size_type n) const { return sv().find_first_not_of(s, pos, n); }
+    [[nodiscard]] constexpr size_type find_first_not_of(const value_type* s, size_type pos = 0) const { return sv().find_first_not_of(s, pos); }
+    [[nodiscard]] constexpr size_type find_first_not_of(value_type c, size_type pos = 0) const noexcept { return sv().find_first_not_of(c, pos); }
+
+    [[nodiscard]] constexpr size_type find_last_not_of(string_view_type v, size_type pos = npos) const noexcept { return sv().find_last_not_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_last_not_of(const value_type* s, size_type pos, size_type n) const { return sv().find_last_not_of(s, pos, n); }
+    [[nodiscard]] constexpr size_type find_last_not_of(const value_type* s, size_type pos = npos) const { return sv().find_last_not_of(s, pos); }
+    [[nodiscard]] constexpr size_type find_last_not_of(value_type c, size_type pos = npos) const noexcept { return sv().find_last_not_of(c, pos); }
+
+    [[nodiscard]] constexpr int compare(string_view_type v) const noexcept { return sv().compare(v); }
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, string_view_type v) const { return sv().compare(pos1, count1, v); }
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, string_view_type v, size_type pos2, size_type count2) const
+    {
+        return sv().compare(pos1, count1, v, pos2, count2);
+    }
+    [[nodiscard]] constexpr int compare(const value_type* s) const { return sv().compare(s); }
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const value_type* s) const { return sv().compare(pos1, count1, s); }
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const value_type* s, size_type count2) const
+    {
+        return sv().compare(pos1, count1, s, count2);
+    }
+
+    [[nodiscard]] constexpr bool starts_with(string_view_type v) const noexcept { return sv().substr(0, v.size()) == v; }
+    [[nodiscard]] constexpr bool starts_with(value_type c) const noexcept { return !empty() && traits_type::eq(_data[0], c); }
+    [[nodiscard]] constexpr bool starts_with(const value_type* s) const noexcept { return starts_with(string_view_type(s)); }
+
+    [[nodiscard]] constexpr bool ends_with(string_view_type v) const noexcept { return size() >= v.size() && compare(size() - v.size(), npos, v) == 0; }
+    [[nodiscard]] constexpr bool ends_with(value_type c) const noexcept { return !empty() && traits_type::eq(_data[N - 1], c); }
+    [[nodiscard]] constexpr bool ends_with(const value_type* s) const { return ends_with(string_view_type(s)); }
+
+    [[nodiscard]] constexpr bool contains(string_view_type v) const noexcept { return find(v) != npos; }
+    [[nodiscard]] constexpr bool contains(value_type c) const noexcept { return find(c) != npos; }
+    [[nodiscard]] constexpr bool contains(const value_type* s) const { return find(s) != npos; }
+#if FIXSTR_CPP20_CNTTP_PRESENT
+    template <::fixstr::basic_fixed_string Needle>
+    [[nodiscard]] constexpr bool contains() const noexcept;
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+  private:
+    constexpr string_view_type sv() const noexcept { return *this; }
+
+    const_pointer _data = nullptr;
+};
+
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+basic_fixed_string_view(const basic_fixed_string<TChar, N, TTraits, TStorage>&) -> basic_fixed_string_view<TChar, N, TTraits>;
+
+template <size_t N>
+using fixed_string_view = basic_fixed_string_view<char, N>;
+#if FIXSTR_CPP20_CHAR8T_PRESENT
+template <size_t N>
+using fixed_u8string_view = basic_fixed_string_view<char8_t, N>;
+#endif // FIXSTR_CPP20_CHAR8T_PRESENT
+template <size_t N>
+using fixed_u16string_view = basic_fixed_string_view<char16_t, N>;
+template <size_t N>
+using fixed_u32string_view = basic_fixed_string_view<char32_t, N>;
+template <size_t N>
+using fixed_wstring_view = basic_fixed_string_view<wchar_t, N>;
+
+namespace details
+{
+template <typename T>
+struct is_fixed_string_view : std::false_type
+{
+};
+
+template <typename TChar, size_t N, typename TTraits>
+struct is_fixed_string_view<basic_fixed_string_view<TChar, N, TTraits>> : std::true_type
+{
+};
+
+// The compile-time size of fixed strings and fixed string views, derived types included, and void for other types
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+std::integral_constant<size_t, N> fixed_extent_of(const basic_fixed_string<TChar, N, TTraits, TStorage>&);
+
+template <typename TChar, size_t N, typename TTraits>
+std::integral_constant<size_t, N> fixed_extent_of(const basic_fixed_string_view<TChar, N, TTraits>&);
+
+void fixed_extent_of(...);
+
+template <typename T>
+using fixed_extent_t = decltype(fixed_extent_of(std::declval<const T&>()));
+
+// Views compare with everything convertible to their string view type: other views, fixed strings, string views and literals
+template <typename TView, typename TOther>
+constexpr bool is_view_comparable_v = std::is_convertible_v<const TOther&, typename TView::string_view_type>;
+
+// Views and fixed strings of the same size are compared with the fixed-size kernels, everything else through string views
+template <typename TChar, size_t N, typename TTraits, typename TOther>
+constexpr bool view_equal(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    if constexpr (std::is_same_v<fixed_extent_t<TOther>, std::integral_constant<size_t, N>>)
+        return fixed_equal<TChar, TTraits, N>(lhs.data(), rhs.data());
+    else
+        return std::basic_string_view<TChar, TTraits>(lhs) == std::basic_string_view<TChar, TTraits>(rhs);
+}
+
+template <typename TChar, size_t N, typename TTraits, typename TOther>
+constexpr int view_compare(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    if constexpr (std::is_same_v<fixed_extent_t<TOther>, std::integral_constant<size_t, N>>)
+        return fixed_compare<TChar, TTraits, N>(lhs.data(), rhs.data());
+    else
+        return std::basic_string_view<TChar, TTraits>(lhs).compare(std::basic_string_view<TChar, TTraits>(rhs));
+}
+} // namespace details
+
+#if FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator==(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    return details::view_equal(lhs, rhs);
+}
+
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr auto operator<=>(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using sv_type = std::basic_string_view<TChar, TTraits>;
+    using result_type = decltype(std::declval<sv_type>() <=> std::declval<sv_type>());
+    return static_cast<result_type>(details::view_compare(lhs, rhs) <=> 0);
+}
+
+#else
+
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator==(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    return details::view_equal(lhs, rhs);
+}
+
+template <typename TOther, typename TChar, size_t N, typename TTraits,
+          typename = std::enable_if_t<!details::is_fixed_string_view<TOther>::value &&
+                                      details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator==(const TOther& lhs, const basic_fixed_string_view<TChar, N, TTraits>& rhs) noexcept
+{
+    return details::view_equal(rhs, lhs);
+}
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator!=(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    return !details::view_equal(lhs, rhs);
+}
+
+template <typename TOther, typename TChar, size_t N, typename TTraits,
+          typename = std::enable_if_t<!details::is_fixed_string_view<TOther>::value &&
+                                      details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator!=(const TOther& lhs, const basic_fixed_string_view<TChar, N, TTraits>& rhs) noexcept
+{
+    return !details::view_equal(rhs, lhs);
+}
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    return details::view_compare(lhs, rhs) < 0;
+}
+
+template <typename TOther, typename TChar, size_t N, typename TTraits,
+          typename = std::enable_if_t<!details::is_fixed_string_view<TOther>::value &&
+                                      details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<(const TOther& lhs, const basic_fixed_string_view<TChar, N, TTraits>& rhs) noexcept
+{
+    return details::view_compare(rhs, lhs) > 0;
+}
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<=(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    return details::view_compare(lhs, rhs) <= 0;
+}
+
+template <typename TOther, typename TChar, size_t N, typename TTraits,
+          typename = std::enable_if_t<!details::is_fixed_string_view<TOther>::value &&
+                                      details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<=(const TOther& lhs, const basic_fixed_string_view<TChar, N, TTraits>& rhs) noexcept
+{
+    return details::view_compare(rhs, lhs) >= 0;
+}
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    return details::view_compare(lhs, rhs) > 0;
+}
+
+template <typename TOther, typename TChar, size_t N, typename TTraits,
+          typename = std::enable_if_t<!details::is_fixed_string_view<TOther>::value &&
+                                      details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>(const TOther& lhs, const basic_fixed_string_view<TChar, N, TTraits>& rhs) noexcept
+{
+    return details::view_compare(rhs, lhs) < 0;
+}
+template <typename TChar, size_t N, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>=(const basic_fixed_string_view<TChar, N, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    return details::view_compare(lhs, rhs) >= 0;
+}
+
+template <typename TOther, typename TChar, size_t N, typename TTraits,
+          typename = std::enable_if_t<!details::is_fixed_string_view<TOther>::value &&
+                                      details::is_view_comparable_v<basic_fixed_string_view<TChar, N, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>=(const TOther& lhs, const basic_fixed_string_view<TChar, N, TTraits>& rhs) noexcept
+{
+    return details::view_compare(rhs, lhs) <= 0;
+}
+
+#endif // FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+
+template <typename TChar, size_t N, typename TTraits>
+std::basic_ostream<TChar, TTraits>& operator<<(std::basic_ostream<TChar, TTraits>& out, const basic_fixed_string_view<TChar, N, TTraits>& str)
+{
+    return out << std::basic_string_view<TChar, TTraits>(str);
+}
+
+namespace details
+{
+// Describes an operand of `concat`: fixed strings, string literals and single characters are accepted.
+// Operands that are not fixed strings do not carry character traits, which is signified by `void`.
+template <typename TChar, size_t N, typename TTraits>
+struct concat_operand
+{
+    using char_type = TChar;
+    using traits_type = TTraits;
+    static constexpr size_t size = N;
+};
+
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+concat_operand<TChar, N, TTraits> concat_operand_of(const basic_fixed_string<TChar, N, TTraits, TStorage>&);
+
+template <typename TChar, size_t N, typename TTraits>
+concat_operand<TChar, N, TTraits> concat_operand_of(const basic_fixed_string_view<TChar, N, TTraits>&);
+
+template <typename TChar, size_t N>
+concat_operand<TChar, N - 1, void> concat_operand_of(const TChar (&)[N]);
+
+template <typename TChar, typename = std::enable_if_t<std::is_integral_v<TChar>>>
+concat_operand<TChar, 1, void> concat_operand_of(TChar);
+
+template <typename T>
+using concat_operand_t = decltype(concat_operand_of(std::declval<const T&>()));
+
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+constexpr const TChar* concat_data(const basic_fixed_string<TChar, N, TTraits, TStorage>& str) noexcept
+{
+    return str.data();
+}
+
+template <typename TChar, size_t N, typename TTraits>
+constexpr const TChar* concat_data(const basic_fixed_string_view<TChar, N, TTraits>& view) noexcept
+{
+    return view.data();
+}
+
+template <typename TChar, size_t N>
+constexpr const TChar* concat_data(const TChar (&array)[N]) noexcept
+{
+    return array;
+}
+
+template <typename TChar, typename = std::enable_if_t<std::is_integral_v<TChar>>>
+constexpr const TChar* concat_data(const TChar& ch) noexcept
+{
+    return &ch;
+}
+
+template <typename TTraits, typename... TOperands>
+struct concat_traits
+{
+    using type = TTraits;
+};
+
+template <typename TTraits, typename TFirst, typename... TRest>
+struct concat_traits<TTraits, TFirst, TRest...>
+{
+    using type = std::conditional_t<std::is_void_v<typename TFirst::traits_type>, typename concat_traits<TTraits, TRest...>::type,
+                                    typename TFirst::traits_type>;
+};
+
+template <typename TFirst, typename... TRest>
+struct concat_result
+{
+    using char_type = typename TFirst::char_type;
+    using traits_type = typename concat_traits<std::char_traits<char_type>, TFirst, TRest...>::type;
+    static constexpr size_t size = (TFirst::size + ... + TRest::size);
+
+    static_assert((std::is_same_v<char_type, typename TRest::char_type> && ...), "all operands must have the same character type");
+    static_assert(((std::is_void_v<typename TRest::traits_type> || std::is_same_v<traits_type, typename TRest::traits_type>) && ...),
+                  "all operands must have the same character traits");
+
+    using type = basic_fixed_string<char_type, size, traits_type>;
+};
+} // namespace details
+
+// Concatenates fixed strings, string literals and characters in a single pass without intermediate results
+template <typename... TOperands>
+[[nodiscard]] constexpr auto concat(const TOperands&... operands) noexcept
+{
+    using result_type = typename details::concat_result<details::concat_operand_t<TOperands>...>::type;
+    result_type           result;
+    [[maybe_unused]] auto out = result.begin();
+    ((out = details::copy(details::concat_data(operands), details::concat_data(operands) + details::concat_operand_t<TOperands>::size, out)), ...);
+    return result;
+}
+
+// Concatenates the operands placing `Separator` between every two of them.
+// The separator is a character or, since C++20, a fixed string.
+template <auto Separator, typename TFirst, typename... TRest>
+[[nodiscard]] constexpr auto join(const TFirst& first, const TRest&... rest) noexcept
+{
+    using separator_operand = details::concat_operand_t<decltype(Separator)>;
+    using result_type = typename details::concat_result<details::concat_operand_t<TFirst>, details::concat_operand_t<TRest>...,
+                                                        details::concat_operand<typename separator_operand::char_type, separator_operand::size * sizeof...(TRest),
+                                                                               typename separator_operand::traits_type>>::type;
+    constexpr auto               separator = Separator;
+    [[maybe_unused]] const auto* separator_data = details::concat_data(separator);
+
+    result_type           result;
+    [[maybe_unused]] auto out = details::copy(details::concat_data(first), details::concat_data(first) + details::concat_operand_t<TFirst>::size, result.begin());
+    ((out = details::copy(separator_data, separator_data + separator_operand::size, out),
+      out = details::copy(details::concat_data(rest), details::concat_data(rest) + details::concat_operand_t<TRest>::size, out)),
+     ...);
+    return result;
+}
+
+// Splits a string into the pieces between occurrences of a delimiter without copying: every piece is a view into the
+// original characters, which must outlive the split_view. The delimiter is a character or a string; N delimiters yield N + 1
+// pieces, so empty pieces are kept and an empty string yields one empty piece.
+template <typename TChar, typename TTraits = std::char_traits<TChar>, typename TDelimiter = TChar>
+class split_view
+{
+  public:
+    using string_view_type = std::basic_string_view<TChar, TTraits>;
+    using size_type = size_t;
+
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = string_view_type;
+
+        constexpr iterator() noexcept = default;
+
+        [[nodiscard]] constexpr reference operator*() const noexcept { return _view->_text.substr(_begin, _end - _begin); }
+
+        constexpr iterator& operator++() noexcept
+        {
+            if (_end == _view->_text.size())
+                _begin = string_view_type::npos;
+            else
+            {
+                _begin = _end + _view->delimiter_size();
+                _end = _view->piece_end(_begin);
+            }
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) noexcept { return lhs._begin == rhs._begin; }
+        [[nodiscard]] friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs) noexcept { return !(lhs == rhs); }
+
+      private:
+        friend class split_view;
+
+        constexpr iterator(const split_view* view, size_type begin) noexcept
+            : _view(view)
+            , _begin(begin)
+            , _end(begin == string_view_type::npos ? begin : view->piece_end(begin))
+        {
+        }
+
+        const split_view* _view = nullptr;
+        size_type         _begin = string_view_type::npos;
+        size_type         _end = string_view_type::npos;
+    };
+
+    using const_iterator = iterator;
+
+    constexpr split_view(string_view_type text, TDelimiter delimiter) noexcept
+        : _text(text)
+        , _delimiter(delimiter)
+    {
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(this, 0); }
+    [[nodiscard]] constexpr iterator end() const noexcept { return iterator(this, string_view_type::npos); }
+
+  private:
+    [[nodiscard]] constexpr size_type delimiter_size() const noexcept
+    {
+        if constexpr (std::is_same_v<TDelimiter, TChar>)
+            return 1;
+        else
+            return _delimiter.size();
+    }
+
+    // End of the piece starting at `begin`; an empty delimiter never matches
+    [[nodiscard]] constexpr size_type piece_end(size_type begin) const noexcept
+    {
+        const auto found = delimiter_size() == 0 ? string_view_type::npos : _text.find(_delimiter, begin);
+        return found == string_view_type::npos ? _text.size() : found;
+    }
+
+    string_view_type _text;
+    TDelimiter       _delimiter;
+};
+
+template <typename TChar, size_t N, typename TTraits>
+split_view(const basic_fixed_string<TChar, N, TTraits>&, TChar) -> split_view<TChar, TTraits>;
+
+template <typename TChar, size_t N, size_t M, typename TTraits>
+split_view(const basic_fixed_string<TChar, N, TTraits>&, const basic_fixed_string<TChar, M, TTraits>&)
+    -> split_view<TChar, TTraits, std::basic_string_view<TChar, TTraits>>;
+
+template <typename TChar, size_t N, size_t M, typename TTraits>
+split_view(const basic_fixed_string<TChar, N, TTraits>&, const TChar (&)[M]) -> split_view<TChar, TTraits, std::basic_string_view<TChar, TTraits>>;
+
+template <typename TChar, typename TTraits>
+split_view(std::basic_string_view<TChar, TTraits>, TChar) -> split_view<TChar, TTraits>;
+
+template <typename TChar, typename TTraits>
+split_view(std::basic_string_view<TChar, TTraits>, std::basic_string_view<TChar, TTraits>)
+    -> split_view<TChar, TTraits, std::basic_string_view<TChar, TTraits>>;
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+namespace details
+{
+// Positions and sizes of the pieces of `Str`, found during compilation with `find`
+template <basic_fixed_string Str, auto Delimiter>
+struct split_pieces
+{
+    static constexpr size_t delimiter_size = concat_operand_t<decltype(Delimiter)>::size;
+    static_assert(delimiter_size > 0, "the delimiter must not be empty");
+
+    static constexpr size_t count = [] {
+        size_t result = 1;
+        for (auto pos = Str.find(Delimiter); pos != Str.npos; pos = Str.find(Delimiter, pos + delimiter_size))
+            ++result;
+        return result;
+    }();
+
+    static constexpr auto bounds = [] {
+        std::array<std::pair<size_t, size_t>, count> result{};
+        size_t                                        begin = 0;
+        for (auto& [pos, size] : result)
+        {
+            const auto end = Str.find(Delimiter, begin);
+            pos = begin;
+            size = (end == Str.npos ? Str.size() : end) - begin;
+            begin += size + delimiter_size;
+        }
+        return result;
+    }();
+};
+
+template <basic_fixed_string Str, auto Delimiter, size_t... Is>
+constexpr auto split(std::index_sequence<Is...>) noexcept
+{
+    using pieces = split_pieces<Str, Delimiter>;
+    return std::tuple{Str.template substr<pieces::bounds[Is].first, pieces::bounds[Is].second>()...};
+}
+} // namespace details
+
+// Splits a string known at compile time into a std::tuple of exactly sized fixed strings.
+// The delimiter is a character or a fixed string; N delimiters yield N + 1 pieces.
+template <basic_fixed_string Str, auto Delimiter>
+[[nodiscard]] constexpr auto split() noexcept
+{
+    return details::split<Str, Delimiter>(std::make_index_sequence<details::split_pieces<Str, Delimiter>::count>{});
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace details
+{
+// Adds `Offset` to the characters in [First, Last] and keeps the others, used for ASCII case mapping
+template <typename TChar, size_t N, typename TTraits, char First, char Last, int Offset>
+constexpr basic_fixed_string<TChar, N, TTraits> shift_range(const basic_fixed_string<TChar, N, TTraits>& str) noexcept
+{
+    basic_fixed_string<TChar, N, TTraits> result = str;
+    for_each_block(result.begin(), result.end(), [](auto first, auto last) {
+        for (; first != last; ++first)
+            if (*first >= TChar(First) && *first <= TChar(Last))
+                *first = static_cast<TChar>(*first + Offset);
+    });
+    return result;
+}
+} // namespace details
+
+// Maps ASCII letters to upper case, other characters are kept
+template <typename TChar, size_t N, typename TTraits>
+[[nodiscard]] constexpr basic_fixed_string<TChar, N, TTraits> to_upper(const basic_fixed_string<TChar, N, TTraits>& str) noexcept
+{
+    return details::shift_range<TChar, N, TTraits, 'a', 'z', 'A' - 'a'>(str);
+}
+
+// Maps ASCII letters to lower case, other characters are kept
+template <typename TChar, size_t N, typename TTraits>
+[[nodiscard]] constexpr basic_fixed_string<TChar, N, TTraits> to_lower(const basic_fixed_string<TChar, N, TTraits>& str) noexcept
+{
+    return details::shift_range<TChar, N, TTraits, 'A', 'Z', 'a' - 'A'>(str);
+}
+
+template <typename TChar, size_t N, typename TTraits>
+[[nodiscard]] constexpr basic_fixed_string<TChar, N, TTraits> reverse(const basic_fixed_string<TChar, N, TTraits>& str) noexcept
+{
+    basic_fixed_string<TChar, N, TTraits> result;
+    auto                                  source = str.end();
+    details::for_each_block(result.begin(), result.end(), [&](auto first, auto last) {
+        while (first != last)
+            *first++ = *--source;
+    });
+    return result;
+}
+
+// Concatenates `Count` copies of `str`. The result is filled by doubling the already written prefix,
+// so building long strings during compilation takes a logarithmic number of copies.
+template <size_t Count, typename TChar, size_t N, typename TTraits>
+[[nodiscard]] constexpr basic_fixed_string<TChar, N * Count, TTraits> repeat(const basic_fixed_string<TChar, N, TTraits>& str) noexcept
+{
+    basic_fixed_string<TChar, N * Count, TTraits> result;
+    if constexpr (N * Count > 0)
+    {
+        details::copy(str.begin(), str.end(), result.begin());
+        for (size_t filled = N; filled < N * Count;)
+        {
+            const size_t count = filled < N * Count - filled ? filled : N * Count - filled;
+            details::copy(result.begin(), result.begin() + count, result.begin() + filled);
+            filled += count;
+        }
+    }
+    return result;
+}
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+namespace details
+{
+template <typename TChar>
+constexpr basic_fixed_string<TChar, 6> whitespace() noexcept
+{
+    const TChar characters[] = {TChar(' '), TChar('\t'), TChar('\n'), TChar('\r'), TChar('\f'), TChar('\v'), TChar()};
+    return characters;
+}
+
+template <basic_fixed_string Str>
+using string_view_of = typename std::remove_cv_t<decltype(Str)>::string_view_type;
+
+template <basic_fixed_string Str, basic_fixed_string Chars, bool Left, bool Right>
+constexpr auto trim() noexcept
+{
+    constexpr string_view_of<Str> str = Str;
+    constexpr string_view_of<Str> chars(Chars.data(), Chars.size());
+    constexpr size_t              first = Left ? str.find_first_not_of(chars) : 0;
+    if constexpr (first == str.npos)
+        return Str.template substr<0, 0>();
+    else
+    {
+        constexpr size_t last = Right ? str.find_last_not_of(chars) : str.size() - 1;
+        return Str.template substr<first, last + 1 - first>();
+    }
+}
+
+template <basic_fixed_string Str, basic_fixed_string From>
+constexpr size_t count_occurrences() noexcept
+{
+    constexpr string_view_of<Str> str = Str;
+    constexpr string_view_of<Str> from(From.data(), From.size());
+    size_t                        result = 0;
+    for (size_t pos = str.find(from); pos != str.npos; pos = str.find(from, pos + from.size()))
+        ++result;
+    return result;
+}
+} // namespace details
+
+// Removes the leading and trailing characters that belong to `Chars`, whitespace by default
+template <basic_fixed_string Str, basic_fixed_string Chars = details::whitespace<typename decltype(Str)::value_type>()>
+[[nodiscard]] constexpr auto trim() noexcept
+{
+    return details::trim<Str, Chars, true, true>();
+}
+
+template <basic_fixed_string Str, basic_fixed_string Chars = details::whitespace<typename decltype(Str)::value_type>()>
+[[nodiscard]] constexpr auto trim_left() noexcept
+{
+    return details::trim<Str, Chars, true, false>();
+}
+
+template <basic_fixed_string Str, basic_fixed_string Chars = details::whitespace<typename decltype(Str)::value_type>()>
+[[nodiscard]] constexpr auto trim_right() noexcept
+{
+    return details::trim<Str, Chars, false, true>();
+}
+
+// Replaces every occurrence of `From`, scanning left to right without overlaps
+template <basic_fixed_string Str, basic_fixed_string From, basic_fixed_string To>
+[[nodiscard]] constexpr auto replace() noexcept
+{
+    static_assert(From.size() > 0, "the replaced string must not be empty");
+    using string_type = std::remove_cv_t<decltype(Str)>;
+    constexpr size_t count = details::count_occurrences<Str, From>();
+
+    constexpr details::string_view_of<Str> str = Str;
+    constexpr details::string_view_of<Str> from(From.data(), From.size());
+
+    basic_fixed_string<typename string_type::value_type, Str.size() + count * To.size() - count * From.size(), typename string_type::traits_type> result;
+    auto   out = result.begin();
+    size_t pos = 0;
+    for (size_t found = str.find(from); found != str.npos; found = str.find(from, pos))
+    {
+        out = details::copy(Str.begin() + pos, Str.begin() + found, out);
+        out = details::copy(To.begin(), To.end(), out);
+        pos = found + From.size();
+    }
+    details::copy(Str.begin() + pos, Str.end(), out);
+    return result;
+}
+
+// Removes every occurrence of the character `Ch`
+template <basic_fixed_string Str, auto Ch>
+[[nodiscard]] constexpr auto remove() noexcept
+{
+    using string_type = std::remove_cv_t<decltype(Str)>;
+    static_assert(std::is_same_v<decltype(Ch), typename string_type::value_type>, "the removed character must have the character type of the string");
+    constexpr size_t count = [] {
+        size_t result = 0;
+        details::for_each_block(Str.begin(), Str.end(), [&](auto first, auto last) {
+            for (; first != last; ++first)
+                result += *first == Ch;
+        });
+        return result;
+    }();
+
+    basic_fixed_string<typename string_type::value_type, Str.size() - count, typename string_type::traits_type> result;
+    auto out = result.begin();
+    details::for_each_block(Str.begin(), Str.end(), [&](auto first, auto last) {
+        for (; first != last; ++first)
+            if (*first != Ch)
+                *out++ = *first;
+    });
+    return result;
+}
+
+template <basic_fixed_string Str, size_t Count>
+[[nodiscard]] constexpr auto repeat() noexcept
+{
+    return repeat<Count>(Str);
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+template <typename TChar, size_t N, size_t M, typename TTraits>
+constexpr basic_fixed_string<TChar, N + M, TTraits> operator+(const basic_fixed_string<TChar, N, TTraits>& lhs, const basic_fixed_string<TChar, M, TTraits>& rhs)
+{
+    return concat(lhs, rhs);
+}
+
+template <typename TChar, size_t N, size_t M, typename TTraits>
+constexpr basic_fixed_string<TChar, N - 1 + M, TTraits> operator+(const TChar (&lhs)[N], const basic_fixed_string<TChar, M, TTraits>& rhs)
+{
+    return concat(lhs, rhs);
+}
+
+template <typename TChar, size_t N, size_t M, typename TTraits>
+constexpr basic_fixed_string<TChar, N + M - 1, TTraits> operator+(const basic_fixed_string<TChar, N, TTraits>& lhs, const TChar (&rhs)[M])
+{
+    return concat(lhs, rhs);
+}
+
+template <typename TChar, size_t N, typename TTraits>
+constexpr basic_fixed_string<TChar, N + 1, TTraits> operator+(TChar lhs, const basic_fixed_string<TChar, N, TTraits>& rhs)
+{
+    return concat(lhs, rhs);
+}
+
+template <typename TChar, size_t N, typename TTraits>
+constexpr basic_fixed_string<TChar, N + 1, TTraits> operator+(const basic_fixed_string<TChar, N, TTraits>& lhs, TChar rhs)
+{
+    return concat(lhs, rhs);
+}
+
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+std::basic_ostream<TChar, TTraits>& operator<<(std::basic_ostream<TChar, TTraits>& out, const basic_fixed_string<TChar, N, TTraits, TStorage>& str)
+{
+    if constexpr (TStorage::terminated)
+        out << str.data();
+    else
+        out << std::basic_string_view<TChar, TTraits>(str);
+    return out;
+}
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+namespace details::kernels
+{
+// Candidate positions of a needle: bit `i` is set when the first and the last needle bytes match at offset `i`.
+// Both blocks are loaded at `haystack` and at `haystack + Distance`, where Distance is the needle size minus one.
+#if FIXSTR_AVX2_PRESENT
+template <size_t Distance>
+unsigned candidates_32(const unsigned char* haystack, unsigned char first, unsigned char last) noexcept
+{
+    const auto f = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack)), _mm256_set1_epi8(static_cast<char>(first)));
+    const auto l = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + Distance)), _mm256_set1_epi8(static_cast<char>(last)));
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_and_si256(f, l)));
+}
+#endif // FIXSTR_AVX2_PRESENT
+
+#if FIXSTR_SSE2_PRESENT
+template <size_t Distance>
+unsigned candidates_16(const unsigned char* haystack, unsigned char first, unsigned char last) noexcept
+{
+    const auto f = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack)), _mm_set1_epi8(static_cast<char>(first)));
+    const auto l = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + Distance)), _mm_set1_epi8(static_cast<char>(last)));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(f, l)));
+}
+
+#if !FIXSTR_AVX2_PRESENT
+// Two SSE2 blocks per step keep the loop overhead of the main scan as low as with AVX2
+template <size_t Distance>
+unsigned candidates_32(const unsigned char* haystack, unsigned char first, unsigned char last) noexcept
+{
+    return candidates_16<Distance>(haystack, first, last) | (candidates_16<Distance>(haystack + 16, first, last) << 16);
+}
+#endif // !FIXSTR_AVX2_PRESENT
+#endif // FIXSTR_SSE2_PRESENT
+} // namespace details::kernels
+
+// Finds a needle known at compile time. The Boyer-Moore-Horspool shift table is built during compilation; at runtime
+// single-byte haystacks are first scanned by SIMD blocks that keep the positions where both the first and the last
+// needle characters match, and every candidate is verified with a comparison unrolled for the needle size.
+template <basic_fixed_string Needle>
+struct searcher
+{
+    using needle_type = std::remove_cv_t<decltype(Needle)>;
+    using value_type = typename needle_type::value_type;
+    using traits_type = typename needle_type::traits_type;
+    using size_type = size_t;
+    using string_view_type = std::basic_string_view<value_type, traits_type>;
+    static constexpr size_type npos = string_view_type::npos;
+
+    // Returns the position of the first occurrence of the needle at or after `pos`, or npos
+    [[nodiscard]] static constexpr size_type find(string_view_type haystack, size_type pos = 0) noexcept
+    {
+        if (pos > haystack.size())
+            return npos;
+        if constexpr (needle_size == 0)
+            return pos;
+        else if constexpr (needle_size == 1)
+            return haystack.find(Needle[0], pos);
+        else
+        {
+#if FIXSTR_HAS_IS_CONSTANT_EVALUATED
+            if constexpr (std::is_same_v<traits_type, std::char_traits<value_type>>)
+            {
+                if (!FIXSTR_IS_CONSTANT_EVALUATED())
+                    return find_bytes(haystack.data(), haystack.size(), pos);
+            }
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
+            return haystack.find(string_view_type(Needle), pos);
+        }
+    }
+
+    [[nodiscard]] constexpr size_type operator()(string_view_type haystack, size_type pos = 0) const noexcept { return find(haystack, pos); }
+
+  private:
+    static constexpr size_type needle_size = Needle.size();
+
+    // Characters wider than a byte are bucketed by their low byte, which keeps every shift safe
+    static constexpr size_t bucket(value_type ch) noexcept { return static_cast<size_t>(static_cast<std::make_unsigned_t<value_type>>(ch) & 0xff); }
+
+    static constexpr std::array<size_type, 256> shifts = [] {
+        std::array<size_type, 256> result{};
+        for (auto& shift : result)
+            shift = needle_size;
+        for (size_type i = 0; i + 1 < needle_size; ++i)
+            result[bucket(Needle[i])] = needle_size - 1 - i;
+        return result;
+    }();
+
+    static bool matches(const value_type* candidate) noexcept
+    {
+        return details::kernels::equal<needle_size * sizeof(value_type)>(reinterpret_cast<const unsigned char*>(candidate),
+                                                                          reinterpret_cast<const unsigned char*>(Needle.data()));
+    }
+
+    static size_type find_bytes(const value_type* haystack, size_type size, size_type pos) noexcept
+    {
+        if (size - pos < needle_size)
+            return npos;
+        const size_type last = size - needle_size;
+        size_type       i = pos;
+
+        if constexpr (sizeof(value_type) == 1)
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(haystack);
+            const auto  first_byte = static_cast<unsigned char>(Needle[0]);
+            const auto  last_byte = static_cast<unsigned char>(Needle[needle_size - 1]);
+            const auto  scan = [&](auto block, auto candidates) -> size_type {
+                constexpr size_type block_size = decltype(block)::value;
+                if (i > last || last - i < block_size - 1)
+                    return npos;
+                // a local cursor lets the compiler keep it in a register across the verification calls
+                size_type       at = i;
+                const size_type end = last - (block_size - 1);
+                for (; at <= end; at += block_size)
+                {
+                    for (unsigned mask = candidates(bytes + at, first_byte, last_byte); mask != 0; mask &= mask - 1)
+                    {
+                        const size_type candidate = at + details::kernels::count_trailing_zeros(mask);
+                        if (matches(haystack + candidate))
+                            return candidate;
+                    }
+                }
+                i = at;
+                return npos;
+            };
+#if FIXSTR_SSE2_PRESENT
+            if (const auto found = scan(std::integral_constant<size_type, 32>{}, details::kernels::candidates_32<needle_size - 1>); found != npos)
+                return found;
+            if (const auto found = scan(std::integral_constant<size_type, 16>{}, details::kernels::candidates_16<needle_size - 1>); found != npos)
+                return found;
+#endif // FIXSTR_SSE2_PRESENT
+            (void)scan;
+        }
+
+        // Horspool: the haystack character under the last needle position decides the shift
+        while (i <= last)
+        {
+            const value_type tail = haystack[i + needle_size - 1];
+            if (tail == Needle[needle_size - 1] && matches(haystack + i))
+                return i;
+            i += shifts[bucket(tail)];
+        }
+        return npos;
+    }
+};
+
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+template <::fixstr::basic_fixed_string Needle>
+constexpr typename basic_fixed_string<TChar, N, TTraits, TStorage>::size_type basic_fixed_string<TChar, N, TTraits, TStorage>::find(size_type pos) const noexcept
+{
+    static_assert(std::is_same_v<typename searcher<Needle>::string_view_type, string_view_type>, "the needle must have the same character type and traits");
+    return searcher<Needle>::find(sv(), pos);
+}
+
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+template <::fixstr::basic_fixed_string Needle>
+constexpr bool basic_fixed_string<TChar, N, TTraits, TStorage>::contains() const noexcept
+{
+    return find<Needle>() != npos;
+}
+
+template <typename TChar, size_t N, typename TTraits>
+template <::fixstr::basic_fixed_string Needle>
+constexpr typename basic_fixed_string_view<TChar, N, TTraits>::size_type basic_fixed_string_view<TChar, N, TTraits>::find(size_type pos) const noexcept
+{
+    static_assert(std::is_same_v<typename searcher<Needle>::string_view_type, string_view_type>, "the needle must have the same character type and traits");
+    return searcher<Needle>::find(sv(), pos);
+}
+
+template <typename TChar, size_t N, typename TTraits>
+template <::fixstr::basic_fixed_string Needle>
+constexpr bool basic_fixed_string_view<TChar, N, TTraits>::contains() const noexcept
+{
+    return find<Needle>() != npos;
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace details::hashing
+{
+// Presents a string as the sequence of bytes it occupies in memory.
+// At runtime multibyte reads are single unaligned loads, during constant evaluation they are assembled from code units.
+template <typename TChar>
+struct byte_reader
+{
+    const TChar* data;
+
+    [[nodiscard]] constexpr std::uint64_t byte(size_t i) const noexcept
+    {
+        constexpr size_t width = sizeof(TChar);
+        const auto       unit = static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<TChar>>(data[i / width]));
+        const size_t     shift = little_endian ? i % width : width - 1 - i % width;
+        return (unit >> (8 * shift)) & 0xff;
+    }
+
+    // Reads `Bytes` bytes starting at byte `offset` as a little-endian integer
+    template <size_t Bytes>
+    [[nodiscard]] constexpr std::uint64_t read(size_t offset) const noexcept
+    {
+        static_assert(Bytes == 4 || Bytes == 8);
+#if FIXSTR_HAS_IS_CONSTANT_EVALUATED
+        if (!FIXSTR_IS_CONSTANT_EVALUATED())
+        {
+            using word_type = std::conditional_t<Bytes == 8, std::uint64_t, std::uint32_t>;
+            word_type word = 0;
+            std::memcpy(&word, reinterpret_cast<const unsigned char*>(data) + offset, Bytes);
+            return little_endian ? word : byteswap(word) >> (64 - 8 * Bytes);
+        }
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
+        std::uint64_t result = 0;
+        for (size_t i = 0; i < Bytes; ++i)
+        {
+            result |= byte(offset + i) << (8 * i);
+        }
+        return result;
+    }
+};
+
+// 64x64 -> 128 bit multiplication, the low half is returned in `a` and the high half in `b`
+constexpr void mum(std::uint64_t& a, std::uint64_t& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128_t = unsigned __int128;
+    const uint128_t r = static_cast<uint128_t>(a) * b;
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    const std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);
+    const std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const std::uint64_t t = rl + (rm0 << 32);
+    std::uint64_t       carry = t < rl;
+    const std::uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif // defined(__SIZEOF_INT128__)
+}
+
+constexpr std::uint64_t mix(std::uint64_t a, std::uint64_t b) noexcept
+{
+    mum(a, b);
+    return a ^ b;
+}
+} // namespace details::hashing
+
+namespace hashing
+{
+// 64-bit FNV-1a, processes one byte at a time
+struct fnv1a
+{
+    template <typename TChar>
+    [[nodiscard]] static constexpr std::uint64_t hash(details::hashing::byte_reader<TChar> reader, size_t size, std::uint64_t seed) noexcept
+    {
+        std::uint64_t h = 0xcbf29ce484222325ULL ^ seed;
+        for (size_t i = 0; i < size; ++i)
+        {
+            h ^= reader.byte(i);
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+};
+
+// wyhash (final version 4), consumes up to 48 bytes per iteration using 64-bit loads
+struct wyhash
+{
+    template <typename TChar>
+    [[nodiscard]] static constexpr std::uint64_t hash(details::hashing::byte_reader<TChar> reader, size_t size, std::uint64_t seed) noexcept
+    {
+        using details::hashing::mix;
+        constexpr std::uint64_t secret[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+        seed ^= mix(seed ^ secret[0], secret[1]);
+        std::uint64_t a = 0;
+        std::uint64_t b = 0;
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                const size_t shift = (size >> 3) << 2;
+                a = (reader.template read<4>(0) << 32) | reader.template read<4>(shift);
+                b = (reader.template read<4>(size - 4) << 32) | reader.template read<4>(size - 4 - shift);
+            }
+            else if (size > 0)
+            {
+                a = (reader.byte(0) << 16) | (reader.byte(size >> 1) << 8) | reader.byte(size - 1);
+            }
+        }
+        else
+        {
+            size_t offset = 0;
+            size_t rest = size;
+            if (rest > 48)
+            {
+                std::uint64_t see1 = seed;
+                std::uint64_t see2 = seed;
+                do
+                {
+                    seed = mix(reader.template read<8>(offset) ^ secret[1], reader.template read<8>(offset + 8) ^ seed);
+                    see1 = mix(reader.template read<8>(offset + 16) ^ secret[2], reader.template read<8>(offset + 24) ^ see1);
+                    see2 = mix(reader.template read<8>(offset + 32) ^ secret[3], reader.template read<8>(offset + 40) ^ see2);
+                    offset += 48;
+                    rest -= 48;
+                } while (rest > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (rest > 16)
+            {
+                seed = mix(reader.template read<8>(offset) ^ secret[1], reader.template read<8>(offset + 8) ^ seed);
+                offset += 16;
+                rest -= 16;
+            }
+            a = reader.template read<8>(offset + rest - 16);
+            b = reader.template read<8>(offset + rest - 8);
+        }
+        a ^= secret[1];
+        b ^= seed;
+        details::hashing::mum(a, b);
+        return mix(a ^ secret[0] ^ size, b ^ secret[1]);
+    }
+};
+} // namespace hashing
+
+// Hash function object for fixed strings and string views with the same contents.
+// The size of a fixed string is a compile-time constant, so its hash is computed with a fully unrolled sequence of loads.
+template <typename TAlgorithm = hashing::wyhash>
+struct basic_hash
+{
+    using is_transparent = void;
+
+    template <typename TChar, size_t N, typename TTraits, typename TStorage>
+    [[nodiscard]] constexpr size_t operator()(const basic_fixed_string<TChar, N, TTraits, TStorage>& str) const noexcept
+    {
+        return static_cast<size_t>(TAlgorithm::hash(details::hashing::byte_reader<TChar>{str.data()}, N * sizeof(TChar), 0));
+    }
+
+    template <typename TChar, size_t N, typename TTraits>
+    [[nodiscard]] constexpr size_t operator()(const basic_fixed_string_view<TChar, N, TTraits>& str) const noexcept
+    {
+        return static_cast<size_t>(TAlgorithm::hash(details::hashing::byte_reader<TChar>{str.data()}, N * sizeof(TChar), 0));
+    }
+
+    template <typename TChar, typename TTraits>
+    [[nodiscard]] constexpr size_t operator()(std::basic_string_view<TChar, TTraits> str) const noexcept
+    {
+        return static_cast<size_t>(TAlgorithm::hash(details::hashing::byte_reader<TChar>{str.data()}, str.size() * sizeof(TChar), 0));
+    }
+};
+
+using hash = basic_hash<>;
+using fnv1a_hash = basic_hash<hashing::fnv1a>;
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+template <basic_fixed_string Str, typename TAlgorithm = hashing::wyhash>
+inline constexpr size_t hash_v = basic_hash<TAlgorithm>{}(Str);
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+} // namespace fixstr
+
+// hash support
+namespace std
+{
+template <typename TChar, size_t N, typename TTraits, typename TStorage>
+struct hash<fixstr::basic_fixed_string<TChar, N, TTraits, TStorage>>
+{
+    using argument_type = fixstr::basic_fixed_string<TChar, N, TTraits, TStorage>;
+    constexpr size_t operator()(const argument_type& str) const noexcept { return fixstr::hash{}(str); }
+};
+
+template <typename TChar, size_t N, typename TTraits>
+struct hash<fixstr::basic_fixed_string_view<TChar, N, TTraits>>
+{
+    using argument_type = fixstr::basic_fixed_string_view<TChar, N, TTraits>;
+    constexpr size_t operator()(const argument_type& str) const noexcept { return fixstr::hash{}(str); }
+};
+
+template <size_t N>
+struct hash<fixstr::fixed_string<N>>
+{
+    using argument_type = fixstr::fixed_string<N>;
+    constexpr size_t operator()(const argument_type& str) const noexcept { return fixstr::hash{}(str); }
+};
+
+#if FIXSTR_CPP20_CHAR8T_PRESENT
+template <size_t N>
+struct hash<fixstr::fixed_u8string<N>>
+{
+    using argument_type = fixstr::fixed_u8string<N>;
+    constexpr size_t operator()(const argument_type& str) const noexcept { return fixstr::hash{}(str); }
+};
+#endif // FIXSTR_CPP20_CHAR8T_PRESENT
+
+template <size_t N>
+struct hash<fixstr::fixed_u16string<N>>
+{
+    using argument_type = fixstr::fixed_u16string<N>;
+    constexpr size_t operator()(const argument_type& str) const noexcept { return fixstr::hash{}(str); }
+};
+
+template <size_t N>
+struct hash<fixstr::fixed_u32string<N>>
+{
+    using argument_type = fixstr::fixed_u32string<N>;
+    constexpr size_t operator()(const argument_type& str) const noexcept { return fixstr::hash{}(str); }
+};
+
+template <size_t N>
+struct hash<fixstr::fixed_wstring<N>>
+{
+    using argument_type = fixstr::fixed_wstring<N>;
+    constexpr size_t operator()(const argument_type& str) const noexcept { return fixstr::hash{}(str); }
 };
 
 } // namespace std
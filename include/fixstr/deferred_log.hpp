@@ -0,0 +1,368 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_DEFERRED_LOG_HPP
+#define FIXSTR_DEFERRED_LOG_HPP
+
+#include "../fixed_string.hpp"
+#include "format.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace fixstr
+{
+namespace details::logging
+{
+using decoder = void (*)(const std::byte* payload, std::ostream& out);
+
+inline constexpr std::uint16_t padding_id = 0xffff;
+inline constexpr size_t        max_sites = padding_id;
+inline constexpr size_t        record_alignment = 8;
+
+// Every (format string, argument types) pair gets a 16-bit ID mapping to the function that decodes its records
+struct site_registry
+{
+    std::atomic<size_t>            count{0};
+    std::array<decoder, max_sites> decoders{};
+};
+
+inline site_registry& registry() noexcept
+{
+    static site_registry instance;
+    return instance;
+}
+
+inline std::uint16_t register_site(decoder decode)
+{
+    auto&        sites = registry();
+    const size_t id = sites.count.fetch_add(1, std::memory_order_relaxed);
+    if (id >= max_sites)
+        throw std::length_error("fixstr::deferred_logger: too many log sites");
+    sites.decoders[id] = decode;
+    return static_cast<std::uint16_t>(id);
+}
+
+struct record_header
+{
+    std::uint16_t id;
+    std::uint16_t reserved;
+    std::uint32_t size;
+};
+
+// String literals are stored as fixed strings, everything else as it is
+template <typename T>
+struct stored
+{
+    using type = T;
+};
+
+template <typename TChar, size_t N>
+struct stored<TChar[N]>
+{
+    using type = basic_fixed_string<TChar, N - 1>;
+};
+
+template <typename T>
+using stored_t = typename stored<std::remove_cv_t<T>>::type;
+
+template <typename... TStored>
+constexpr size_t record_size() noexcept
+{
+    const size_t size = sizeof(record_header) + (size_t(0) + ... + sizeof(TStored));
+    return (size + record_alignment - 1) / record_alignment * record_alignment;
+}
+
+template <typename T>
+std::byte* encode(std::byte* out, const T& value) noexcept
+{
+    if constexpr (std::is_same_v<stored_t<T>, T>)
+    {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+    else
+    {
+        const stored_t<T> converted = value;
+        std::memcpy(out, &converted, sizeof(converted));
+        return out + sizeof(converted);
+    }
+}
+
+template <basic_fixed_string Format, typename... TStored>
+void decode(const std::byte* payload, std::ostream& out)
+{
+    std::tuple<TStored...> args;
+    std::apply([&](auto&... arg) { ((std::memcpy(&arg, payload, sizeof(arg)), payload += sizeof(arg)), ...); }, args);
+
+    char       buffer[max_formatted_size_v<Format, TStored...> + 1];
+    const auto end = std::apply([&](const auto&... arg) { return format_to<Format>(buffer, arg...); }, args);
+    *end = '\n';
+    out.write(buffer, end + 1 - buffer);
+}
+
+// Single-producer single-consumer ring of variable-size records. Every record is contiguous:
+// when it does not fit before the end of the buffer, the rest of the buffer is skipped with a padding record.
+class record_ring
+{
+  public:
+    // `capacity` is rounded up to a power of two
+    explicit record_ring(size_t capacity)
+    {
+        size_t rounded = 64;
+        while (rounded < capacity)
+            rounded <<= 1;
+        _buffer = std::make_unique<std::byte[]>(rounded);
+        _mask = rounded - 1;
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept { return _mask + 1; }
+
+    // Producer: returns `size` contiguous bytes to be published with `commit`, or nullptr if the ring is full
+    [[nodiscard]] std::byte* try_reserve(size_t size) noexcept
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t offset = head & _mask;
+        const size_t padding = offset + size > capacity() ? capacity() - offset : 0;
+        const size_t end = head + padding + size;
+        if (end - _cached_tail > capacity())
+        {
+            _cached_tail = _tail.load(std::memory_order_acquire);
+            if (end - _cached_tail > capacity())
+                return nullptr;
+        }
+        if (padding != 0)
+        {
+            const record_header header = {padding_id, 0, static_cast<std::uint32_t>(padding)};
+            std::memcpy(_buffer.get() + offset, &header, sizeof(header));
+        }
+        _reserved_end = end;
+        return _buffer.get() + ((end - size) & _mask);
+    }
+
+    void commit() noexcept { _head.store(_reserved_end, std::memory_order_release); }
+
+    // Consumer: calls `handler(id, payload)` for every published record and returns their number
+    template <typename THandler>
+    size_t consume(THandler&& handler)
+    {
+        size_t       tail = _tail.load(std::memory_order_relaxed);
+        const size_t head = _head.load(std::memory_order_acquire);
+        size_t       count = 0;
+        while (tail != head)
+        {
+            const std::byte* record = _buffer.get() + (tail & _mask);
+            record_header    header;
+            std::memcpy(&header, record, sizeof(header));
+            if (header.id != padding_id)
+            {
+                handler(header.id, record + sizeof(header));
+                ++count;
+            }
+            tail += header.size;
+        }
+        _tail.store(tail, std::memory_order_release);
+        return count;
+    }
+
+    [[nodiscard]] size_t published() const noexcept { return _head.load(std::memory_order_acquire); }
+    [[nodiscard]] bool   consumed(size_t position) const noexcept { return _tail.load(std::memory_order_acquire) >= position; }
+
+    std::thread::id owner;
+
+  private:
+    std::unique_ptr<std::byte[]> _buffer;
+    size_t                       _mask = 0;
+
+    alignas(64) std::atomic<size_t> _head{0};
+    size_t _cached_tail = 0;
+    size_t _reserved_end = 0;
+
+    alignas(64) std::atomic<size_t> _tail{0};
+};
+
+struct ring_cache
+{
+    std::uint64_t logger = 0;
+    record_ring*  ring = nullptr;
+};
+
+inline thread_local ring_cache cached_ring;
+inline std::atomic<std::uint64_t> logger_serial{0};
+} // namespace details::logging
+
+// NanoLog-style deferred logger: the logging thread writes a 16-bit message ID and the raw argument bytes into its own
+// lock-free ring, and a background thread decodes and formats the records into the stream, one message per line.
+// Arguments are the trivially copyable types accepted by `format_to`: numbers, characters, fixed strings, string literals and inplace strings.
+class deferred_logger
+{
+  public:
+    // Every logging thread gets a ring of `ring_capacity` bytes
+    explicit deferred_logger(std::ostream& out, size_t ring_capacity = size_t(1) << 20)
+        : _out(out), _ring_capacity(ring_capacity), _serial(++details::logging::logger_serial), _consumer([this] { run(); })
+    {
+    }
+
+    deferred_logger(const deferred_logger&) = delete;
+    deferred_logger& operator=(const deferred_logger&) = delete;
+
+    // Writes everything logged so far and stops the background thread
+    ~deferred_logger()
+    {
+        _stop.store(true, std::memory_order_release);
+        _consumer.join();
+    }
+
+    // Never blocks: returns false and counts the message as dropped if the ring of the calling thread is full
+    template <basic_fixed_string Format, typename... TArgs>
+    bool log(const TArgs&... args)
+    {
+        static_assert(std::is_same_v<typename std::remove_cv_t<decltype(Format)>::value_type, char>, "only char format strings are supported");
+        static_assert((std::is_trivially_copyable_v<details::logging::stored_t<TArgs>> && ...), "arguments are copied as raw bytes and must be trivially copyable");
+        static const std::uint16_t id = details::logging::register_site(&details::logging::decode<Format, details::logging::stored_t<TArgs>...>);
+        constexpr size_t           size = details::logging::record_size<details::logging::stored_t<TArgs>...>();
+
+        auto&      ring = local_ring();
+        std::byte* record = size <= ring.capacity() ? ring.try_reserve(size) : nullptr;
+        if (record == nullptr)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const details::logging::record_header header = {id, 0, static_cast<std::uint32_t>(size)};
+        std::memcpy(record, &header, sizeof(header));
+        [[maybe_unused]] std::byte* out = record + sizeof(header);
+        ((out = details::logging::encode(out, args)), ...);
+        ring.commit();
+        return true;
+    }
+
+    // Waits until every message logged before the call is written and the stream is flushed
+    void flush()
+    {
+        std::vector<std::pair<details::logging::record_ring*, size_t>> targets;
+        {
+            std::lock_guard<std::mutex> lock(_rings_mutex);
+            for (const auto& ring : _rings)
+                targets.emplace_back(ring.get(), ring->published());
+        }
+        for (const auto& [ring, position] : targets)
+            while (!ring->consumed(position))
+                std::this_thread::yield();
+        const auto epoch = _idle_epoch.load(std::memory_order_acquire);
+        while (_idle_epoch.load(std::memory_order_acquire) == epoch)
+            std::this_thread::yield();
+    }
+
+    [[nodiscard]] size_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+  private:
+    details::logging::record_ring& local_ring()
+    {
+        auto& cache = details::logging::cached_ring;
+        if (cache.logger == _serial)
+            return *cache.ring;
+
+        std::lock_guard<std::mutex> lock(_rings_mutex);
+        const auto                  self = std::this_thread::get_id();
+        details::logging::record_ring* ring = nullptr;
+        for (const auto& candidate : _rings)
+            if (candidate->owner == self)
+                ring = candidate.get();
+        if (ring == nullptr)
+        {
+            ring = _rings.emplace_back(std::make_unique<details::logging::record_ring>(_ring_capacity)).get();
+            ring->owner = self;
+            _ring_count.store(_rings.size(), std::memory_order_release);
+        }
+        cache = {_serial, ring};
+        return *ring;
+    }
+
+    void run()
+    {
+        std::vector<details::logging::record_ring*> rings;
+        bool                                        unflushed = false;
+        while (true)
+        {
+            const bool stopping = _stop.load(std::memory_order_acquire);
+            if (rings.size() != _ring_count.load(std::memory_order_acquire))
+            {
+                std::lock_guard<std::mutex> lock(_rings_mutex);
+                rings.clear();
+                for (const auto& ring : _rings)
+                    rings.push_back(ring.get());
+            }
+
+            size_t processed = 0;
+            for (auto* ring : rings)
+                processed += ring->consume([this](std::uint16_t id, const std::byte* payload) { details::logging::registry().decoders[id](payload, _out); });
+
+            if (processed != 0)
+            {
+                unflushed = true;
+                continue;
+            }
+            if (unflushed)
+            {
+                _out.flush();
+                unflushed = false;
+            }
+            _idle_epoch.fetch_add(1, std::memory_order_release);
+            if (stopping)
+                break;
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    std::ostream&                                               _out;
+    size_t                                                      _ring_capacity;
+    std::uint64_t                                               _serial;
+    std::mutex                                                  _rings_mutex;
+    std::vector<std::unique_ptr<details::logging::record_ring>> _rings;
+    std::atomic<size_t>                                         _ring_count{0};
+    std::atomic<size_t>                                         _dropped{0};
+    std::atomic<size_t>                                         _idle_epoch{0};
+    std::atomic<bool>                                           _stop{false};
+    std::thread                                                 _consumer;
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+#endif // FIXSTR_DEFERRED_LOG_HPP
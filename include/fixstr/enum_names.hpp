@@ -0,0 +1,298 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_ENUM_NAMES_HPP
+#define FIXSTR_ENUM_NAMES_HPP
+
+#include "../fixed_string.hpp"
+#include "string_switch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace fixstr
+{
+
+// Values probed when enumerator names are extracted from the compiler. Specialize to widen or narrow the range.
+template <typename E>
+struct enum_range
+{
+    using underlying_type = std::underlying_type_t<E>;
+
+    static constexpr long long min = std::is_signed_v<underlying_type> ? std::max<long long>(-128, std::numeric_limits<underlying_type>::min()) : 0;
+    static constexpr long long max = std::min<unsigned long long>(128, std::numeric_limits<underlying_type>::max());
+};
+
+namespace details::enums
+{
+template <auto Value>
+constexpr std::string_view signature() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+// Unqualified name of an enumerator, empty if `Value` does not name one
+template <auto Value>
+constexpr std::string_view name_of() noexcept
+{
+    std::string_view name = signature<Value>();
+#if defined(_MSC_VER) && !defined(__clang__)
+    // "... signature<ns::color::red>(void) noexcept"
+    const auto begin = name.find("signature<");
+    const auto end = name.rfind(">(");
+    if (begin == std::string_view::npos || end == std::string_view::npos)
+        return {};
+    name = name.substr(begin + 10, end - begin - 10);
+#else
+    // "... [with auto Value = ns::color::red; ...]" or "... [Value = ns::color::red]"
+    const auto begin = name.find("Value = ");
+    if (begin == std::string_view::npos)
+        return {};
+    name = name.substr(begin + 8);
+    name = name.substr(0, name.find_first_of(";]"));
+#endif
+    // values without an enumerator are printed as casts or numbers
+    if (name.empty() || name.front() == '(' || name.front() == '-' || (name.front() >= '0' && name.front() <= '9'))
+        return {};
+    if (const auto scope = name.rfind("::"); scope != std::string_view::npos)
+        name.remove_prefix(scope + 2);
+    return name;
+}
+
+template <typename E, size_t N>
+struct reflection
+{
+    std::array<E, N>                values{};
+    std::array<std::string_view, N> names{};
+    size_t                          count = 0;
+};
+
+template <typename E, size_t... Is>
+constexpr auto reflect(std::index_sequence<Is...>) noexcept
+{
+    constexpr std::array<std::string_view, sizeof...(Is)> candidates = {name_of<static_cast<E>(enum_range<E>::min + static_cast<long long>(Is))>()...};
+
+    reflection<E, sizeof...(Is)> result;
+    for (size_t i = 0; i < candidates.size(); ++i)
+        if (!candidates[i].empty())
+        {
+            result.values[result.count] = static_cast<E>(enum_range<E>::min + static_cast<long long>(i));
+            result.names[result.count++] = candidates[i];
+        }
+    return result;
+}
+
+template <typename E>
+inline constexpr auto reflected = reflect<E>(std::make_index_sequence<static_cast<size_t>(enum_range<E>::max - enum_range<E>::min + 1)>{});
+
+template <typename E, size_t N>
+constexpr size_t total_size(const std::array<std::string_view, N>& names) noexcept
+{
+    size_t result = 0;
+    for (const auto name : names)
+        result += name.size() + 1;
+    return result;
+}
+
+// Names packed into one null-terminated character array, values ascending
+template <typename E, size_t N, size_t Chars>
+struct table
+{
+    std::array<E, N>                  values{};
+    std::array<char, Chars>           chars{};
+    std::array<std::uint32_t, N + 1> offsets{};
+};
+
+template <typename E, size_t N, size_t Chars>
+constexpr table<E, N, Chars> make_table(const std::array<E, N>& values, const std::array<std::string_view, N>& names) noexcept
+{
+    table<E, N, Chars> result;
+    result.values = values;
+    size_t offset = 0;
+    for (size_t i = 0; i < N; ++i)
+    {
+        result.offsets[i] = static_cast<std::uint32_t>(offset);
+        details::copy(names[i].begin(), names[i].end(), result.chars.begin() + offset);
+        offset += names[i].size() + 1;
+    }
+    result.offsets[N] = static_cast<std::uint32_t>(offset);
+    return result;
+}
+
+template <typename E>
+constexpr long long to_integer(E value) noexcept
+{
+    return static_cast<long long>(static_cast<std::underlying_type_t<E>>(value));
+}
+} // namespace details::enums
+
+// Constexpr table of enumerator names. Without `Names` they are extracted from the compiler for the values in
+// enum_range<E>; with `Names`, the I-th name spells E(I). Lookups in both directions are table driven, allocate nothing
+// and the whole table is constant-initialized.
+template <typename E, basic_fixed_string... Names>
+struct enum_names
+{
+    static_assert(std::is_enum_v<E>, "enum_names requires an enumeration type");
+    static_assert(((std::is_same_v<typename decltype(Names)::value_type, char>) && ...), "enum_names requires char names");
+
+    using enum_type = E;
+    using size_type = size_t;
+
+  private:
+    static constexpr bool declared = sizeof...(Names) > 0;
+
+    static constexpr auto source()
+    {
+        if constexpr (declared)
+        {
+            details::enums::reflection<E, sizeof...(Names)> result;
+            size_type                                       i = 0;
+            ((result.values[i] = static_cast<E>(i), result.names[i++] = std::string_view(Names)), ...);
+            result.count = sizeof...(Names);
+            return result;
+        }
+        else
+            return details::enums::reflected<E>;
+    }
+
+    static constexpr auto      _source = source();
+    static constexpr size_type count = _source.count;
+
+    template <size_t... Is>
+    static constexpr auto trim(std::index_sequence<Is...>) noexcept
+    {
+        return std::pair{std::array<E, count>{_source.values[Is]...}, std::array<std::string_view, count>{_source.names[Is]...}};
+    }
+
+    static constexpr auto _trimmed = trim(std::make_index_sequence<count>{});
+    static constexpr auto _table = details::enums::make_table<E, count, details::enums::total_size<E>(_trimmed.second)>(_trimmed.first, _trimmed.second);
+
+    static constexpr long long min_value = count == 0 ? 0 : details::enums::to_integer(_table.values[0]);
+    static constexpr long long max_value = count == 0 ? -1 : details::enums::to_integer(_table.values[count - 1]);
+    static constexpr bool      contiguous = static_cast<size_type>(max_value - min_value + 1) == count;
+
+    // Index of every value in [min_value, max_value], `count` for the gaps. Only needed when the values are not contiguous.
+    using index_type = std::conditional_t<(count < 0xff), std::uint8_t, std::uint16_t>;
+    static constexpr auto make_index()
+    {
+        std::array<index_type, contiguous ? 0 : static_cast<size_type>(max_value - min_value + 1)> result{};
+        if constexpr (!contiguous)
+        {
+            for (auto& index : result)
+                index = static_cast<index_type>(count);
+            for (size_type i = 0; i < count; ++i)
+                result[static_cast<size_type>(details::enums::to_integer(_table.values[i]) - min_value)] = static_cast<index_type>(i);
+        }
+        return result;
+    }
+
+    static constexpr auto _index = make_index();
+
+    template <size_t I>
+    static constexpr auto fixed_name = [] {
+        constexpr auto                         name = _trimmed.second[I];
+        basic_fixed_string<char, name.size()> result;
+        details::copy(name.begin(), name.end(), result.begin());
+        return result;
+    }();
+
+    template <size_t... Is>
+    static constexpr auto make_switch(std::index_sequence<Is...>)
+    {
+        if constexpr (declared)
+            return switch_table<Names...>{};
+        else
+            return switch_table<fixed_name<Is>...>{};
+    }
+
+  public:
+    [[nodiscard]] static constexpr size_type size() noexcept { return count; }
+
+    [[nodiscard]] static constexpr E value(size_type i) noexcept { return _table.values[i]; }
+
+    // Null-terminated name of the I-th value in ascending order
+    [[nodiscard]] static constexpr std::string_view name(size_type i) noexcept
+    {
+        return {_table.chars.data() + _table.offsets[i], _table.offsets[i + 1] - _table.offsets[i] - 1};
+    }
+
+    // Name of `value`, or an empty view if it has none
+    [[nodiscard]] static constexpr std::string_view to_string(E value) noexcept
+    {
+        const auto raw = details::enums::to_integer(value);
+        if (raw < min_value || raw > max_value)
+            return {};
+        if constexpr (contiguous)
+            return name(static_cast<size_type>(raw - min_value));
+        else
+        {
+            const size_type i = _index[static_cast<size_type>(raw - min_value)];
+            return i == count ? std::string_view{} : name(i);
+        }
+    }
+
+    [[nodiscard]] static constexpr std::optional<E> from_string(std::string_view str) noexcept
+    {
+        if constexpr (count == 0)
+            return std::nullopt;
+        else
+        {
+            using switch_type = decltype(make_switch(std::make_index_sequence<count>{}));
+            const auto i = switch_type::index_of(str);
+            if (i == switch_type::npos)
+                return std::nullopt;
+            return _table.values[i];
+        }
+    }
+};
+
+template <typename E>
+[[nodiscard]] constexpr std::string_view enum_to_string(E value) noexcept
+{
+    return enum_names<E>::to_string(value);
+}
+
+template <typename E>
+[[nodiscard]] constexpr std::optional<E> enum_from_string(std::string_view str) noexcept
+{
+    return enum_names<E>::from_string(str);
+}
+
+} // namespace fixstr
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+#endif // FIXSTR_ENUM_NAMES_HPP
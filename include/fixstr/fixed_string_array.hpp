@@ -0,0 +1,490 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_FIXED_STRING_ARRAY_HPP
+#define FIXSTR_FIXED_STRING_ARRAY_HPP
+
+#include "../fixed_string.hpp"
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fixstr
+{
+
+// Layouts of fixed_string_array.
+// Rows store the elements one after another without terminators, so elements are accessible as views.
+// Column blocks transpose every 32 elements byte by byte: byte `j` of 32 neighbouring elements is one vector register,
+// batch operations test 32 elements per instruction and elements are returned as copies.
+struct row_layout
+{
+};
+
+struct column_layout
+{
+    static constexpr size_t block = 32;
+};
+
+// The result of a batch operation of fixed_string_array: bit `i` is set when element `i` matched
+class match_mask
+{
+  public:
+    static constexpr size_t npos = size_t(-1);
+
+    match_mask() = default;
+    match_mask(std::vector<std::uint64_t> words, size_t size) noexcept : _words(std::move(words)), _size(size) {}
+
+    [[nodiscard]] size_t size() const noexcept { return _size; }
+    [[nodiscard]] bool   test(size_t index) const noexcept { return (_words[index / 64] >> (index % 64)) & 1; }
+
+    [[nodiscard]] const std::vector<std::uint64_t>& words() const noexcept { return _words; }
+
+    [[nodiscard]] size_t count() const noexcept
+    {
+        size_t result = 0;
+        for (const auto word : _words)
+            result += popcount(word);
+        return result;
+    }
+
+    // The first matched index not less than `from`, or npos
+    [[nodiscard]] size_t find_next(size_t from) const noexcept
+    {
+        if (from >= _size)
+            return npos;
+        size_t w = from / 64;
+        auto   word = _words[w] & (~std::uint64_t(0) << (from % 64));
+        while (word == 0)
+        {
+            if (++w == _words.size())
+                return npos;
+            word = _words[w];
+        }
+        return w * 64 + lowest_bit(word);
+    }
+
+    [[nodiscard]] size_t find_first() const noexcept { return find_next(0); }
+
+    // Calls `f(index)` for every matched index in increasing order
+    template <typename TFunction>
+    void for_each(TFunction f) const
+    {
+        for (size_t w = 0; w < _words.size(); ++w)
+        {
+            for (auto word = _words[w]; word != 0; word &= word - 1)
+                f(w * 64 + lowest_bit(word));
+        }
+    }
+
+  private:
+    static size_t popcount(std::uint64_t value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_popcountll(value));
+#else
+        size_t count = 0;
+        for (; value != 0; value &= value - 1)
+            ++count;
+        return count;
+#endif
+    }
+
+    static size_t lowest_bit(std::uint64_t value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(value));
+#elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<size_t>(index);
+#else
+        size_t index = 0;
+        while ((value & 1) == 0)
+        {
+            value >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    std::vector<std::uint64_t> _words;
+    size_t                     _size = 0;
+};
+
+namespace details::string_array
+{
+// Batch kernels over rows: the loads of an element may read past it into the next element or into the slack
+// at the end of the storage, the bytes that do not belong to the element are masked out.
+template <size_t N>
+struct row_kernels
+{
+    static constexpr size_t blocks = (N + 15) / 16;
+    static constexpr size_t slack = blocks * 16 - N;
+
+    // A prefix as 8-byte words and the masks of its bytes in them
+    struct pattern
+    {
+        std::array<std::uint64_t, (N + 7) / 8> words{};
+        std::array<std::uint64_t, (N + 7) / 8> masks{};
+        size_t                                 used = 0;
+    };
+
+    static pattern make_pattern(const char* value, size_t size) noexcept
+    {
+        pattern                           result;
+        std::array<char, (N + 7) / 8 * 8> bytes{};
+        std::array<char, (N + 7) / 8 * 8> mask{};
+        details::copy(value, value + size, bytes.data());
+        details::fill(mask.data(), mask.data() + size, char(-1));
+        for (size_t w = 0; w < result.words.size(); ++w)
+        {
+            std::memcpy(&result.words[w], bytes.data() + w * 8, 8);
+            std::memcpy(&result.masks[w], mask.data() + w * 8, 8);
+        }
+        result.used = (size + 7) / 8;
+        return result;
+    }
+
+    // Whether the element starts with the pattern, compared a word at a time with the bytes past the prefix masked out
+    static bool starts_with(const char* element, const pattern& p) noexcept
+    {
+        std::uint64_t difference = 0;
+        for (size_t w = 0; w < p.used; ++w)
+            difference |= (kernels::load<std::uint64_t>(reinterpret_cast<const unsigned char*>(element) + w * 8) ^ p.words[w]) & p.masks[w];
+        return difference == 0;
+    }
+
+    static bool contains(const char* element, char ch) noexcept
+    {
+        unsigned found = 0;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            constexpr unsigned last_bits = N % 16 == 0 ? 0xffffu : (1u << (N % 16)) - 1;
+            const unsigned     bits = b + 1 == blocks ? last_bits : 0xffffu;
+#if FIXSTR_SSE2_PRESENT
+            const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(element + b * 16));
+            found |= static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(ch)))) & bits;
+#else
+            for (size_t i = 0; i < 16; ++i)
+                found |= (unsigned(element[b * 16 + i] == ch) << i) & bits;
+#endif // FIXSTR_SSE2_PRESENT
+        }
+        return found != 0;
+    }
+};
+
+// Batch kernels over column blocks: the result has bit `k` set when element `k` of the block matched
+template <size_t N>
+struct column_kernels
+{
+    static constexpr size_t block = column_layout::block;
+
+#if FIXSTR_AVX2_PRESENT
+    static std::uint32_t equal_bits(const char* row, char ch) noexcept
+    {
+        const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row));
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(ch))));
+    }
+#elif FIXSTR_SSE2_PRESENT
+    static std::uint32_t equal_bits(const char* row, char ch) noexcept
+    {
+        const auto needle = _mm_set1_epi8(ch);
+        const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+        const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 16));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(low, needle))) |
+               static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(high, needle))) << 16;
+    }
+#else
+    static std::uint32_t equal_bits(const char* row, char ch) noexcept
+    {
+        std::uint32_t result = 0;
+        for (size_t k = 0; k < block; ++k)
+            result |= std::uint32_t(row[k] == ch) << k;
+        return result;
+    }
+#endif // FIXSTR_AVX2_PRESENT
+
+    static std::uint32_t starts_with(const char* data, const char* value, size_t size) noexcept
+    {
+        // after a few bytes no element of the block matches as a rule, the rest of the block is not read then
+        std::uint32_t result = ~std::uint32_t(0);
+        for (size_t j = 0; j < size && result != 0; ++j)
+            result &= equal_bits(data + j * block, value[j]);
+        return result;
+    }
+
+    static std::uint32_t contains(const char* data, char ch) noexcept
+    {
+        std::uint32_t result = 0;
+        for (size_t j = 0; j < N; ++j)
+            result |= equal_bits(data + j * block, ch);
+        return result;
+    }
+};
+} // namespace details::string_array
+
+// A contiguous container of many fixed_string<N> without terminators, with batch operations that produce bitmasks.
+template <size_t N, typename TLayout = row_layout>
+class fixed_string_array
+{
+    static_assert(std::is_same_v<TLayout, row_layout> || std::is_same_v<TLayout, column_layout>, "unknown layout");
+    static_assert(N > 0, "elements must not be empty");
+
+    static constexpr bool columns = std::is_same_v<TLayout, column_layout>;
+
+  public:
+    using value_type = fixed_string<N>;
+    using layout_type = TLayout;
+    // Views into the storage for rows, copies for column blocks
+    using reference = std::conditional_t<columns, fixed_string<N>, fixed_string_view<N>>;
+    using size_type = size_t;
+
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = fixed_string<N>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = typename fixed_string_array::reference;
+
+        const_iterator() = default;
+
+        [[nodiscard]] reference operator*() const noexcept { return (*_array)[_index]; }
+        const_iterator&         operator++() noexcept
+        {
+            ++_index;
+            return *this;
+        }
+        const_iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++_index;
+            return copy;
+        }
+
+        [[nodiscard]] friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs._index == rhs._index; }
+        [[nodiscard]] friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs._index != rhs._index; }
+
+      private:
+        friend class fixed_string_array;
+        const_iterator(const fixed_string_array* array, size_t index) noexcept : _array(array), _index(index) {}
+
+        const fixed_string_array* _array = nullptr;
+        size_t                    _index = 0;
+    };
+
+    fixed_string_array() = default;
+
+    fixed_string_array(std::initializer_list<fixed_string_view<N>> values)
+    {
+        reserve(values.size());
+        for (const auto value : values)
+            push_back(value);
+    }
+
+    template <typename InputIterator>
+    fixed_string_array(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return _size; }
+    [[nodiscard]] bool   empty() const noexcept { return _size == 0; }
+
+    void reserve(size_t count) { _bytes.reserve(bytes_for(count)); }
+
+    void clear() noexcept
+    {
+        _bytes.clear();
+        _size = 0;
+    }
+
+    template <typename TStorage>
+    void push_back(const basic_fixed_string<char, N, std::char_traits<char>, TStorage>& value)
+    {
+        push_back(fixed_string_view<N>(value));
+    }
+
+    void push_back(fixed_string_view<N> value)
+    {
+        _bytes.resize(bytes_for(_size + 1));
+        if constexpr (columns)
+        {
+            char* row = block_data(_size / block) + _size % block;
+            for (size_t j = 0; j < N; ++j)
+                row[j * block] = value[j];
+        }
+        else
+            details::copy(value.begin(), value.end(), _bytes.data() + _size * N);
+        ++_size;
+    }
+
+    // Throws std::length_error if `value` is not exactly N characters long
+    void push_back(std::string_view value)
+    {
+        if (value.size() != N)
+            throw std::length_error("fixstr::fixed_string_array: the value size differs from the element size");
+        push_back(fixed_string_view<N>(value.data()));
+    }
+
+    void pop_back() noexcept
+    {
+        --_size;
+        _bytes.resize(bytes_for(_size));
+    }
+
+    [[nodiscard]] reference operator[](size_t index) const noexcept
+    {
+        if constexpr (columns)
+        {
+            fixed_string<N> result;
+            const char*     row = block_data(index / block) + index % block;
+            for (size_t j = 0; j < N; ++j)
+                result[j] = row[j * block];
+            return result;
+        }
+        else
+            return fixed_string_view<N>(_bytes.data() + index * N);
+    }
+
+    [[nodiscard]] reference at(size_t index) const
+    {
+        if (index >= _size)
+            throw std::out_of_range("fixstr::fixed_string_array::at: index is out of range");
+        return (*this)[index];
+    }
+
+    [[nodiscard]] reference front() const noexcept { return (*this)[0]; }
+    [[nodiscard]] reference back() const noexcept { return (*this)[_size - 1]; }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this, _size); }
+
+    // The elements of size() * N characters, without separators
+    template <typename T = TLayout, typename = std::enable_if_t<std::is_same_v<T, row_layout>>>
+    [[nodiscard]] const char* data() const noexcept
+    {
+        return _bytes.data();
+    }
+
+    // Elements equal to `value`, rows are compared with the fixed-size comparison kernels of fixed_string
+    [[nodiscard]] match_mask find_equal(fixed_string_view<N> value) const
+    {
+        if constexpr (columns)
+            return starts_with_mask(value.data(), N);
+        else
+            return make_mask([&](const char* element) { return details::fixed_equal<char, std::char_traits<char>, N>(element, value.data()); });
+    }
+
+    // Elements that contain the character `ch`
+    [[nodiscard]] match_mask filter_contains(char ch) const
+    {
+        if constexpr (columns)
+            return make_mask([&](const char* data) { return details::string_array::column_kernels<N>::contains(data, ch); });
+        else
+            return make_mask([&](const char* element) { return details::string_array::row_kernels<N>::contains(element, ch); });
+    }
+
+    // Elements that start with `prefix`, none if it is longer than the elements
+    [[nodiscard]] match_mask filter_prefix(std::string_view prefix) const
+    {
+        return prefix.size() > N ? match_mask(std::vector<std::uint64_t>(words_for(_size)), _size) : starts_with_mask(prefix.data(), prefix.size());
+    }
+
+    [[nodiscard]] size_t count_equal(fixed_string_view<N> value) const { return find_equal(value).count(); }
+    [[nodiscard]] size_t count_prefix(std::string_view prefix) const { return filter_prefix(prefix).count(); }
+
+  private:
+    static constexpr size_t block = column_layout::block;
+
+    static constexpr size_t words_for(size_t count) noexcept { return (count + 63) / 64; }
+
+    // Rows keep slack after the last element for the block loads of the batch kernels,
+    // column blocks are allocated whole and their unused lanes are masked out.
+    static constexpr size_t bytes_for(size_t count) noexcept
+    {
+        if constexpr (columns)
+            return (count + block - 1) / block * block * N;
+        else
+            return count == 0 ? 0 : count * N + details::string_array::row_kernels<N>::slack;
+    }
+
+    const char* block_data(size_t index) const noexcept { return _bytes.data() + index * block * N; }
+    char*       block_data(size_t index) noexcept { return _bytes.data() + index * block * N; }
+
+    match_mask starts_with_mask(const char* value, size_t size) const
+    {
+        if constexpr (columns)
+            return make_mask([&](const char* data) { return details::string_array::column_kernels<N>::starts_with(data, value, size); });
+        else
+        {
+            const auto pattern = details::string_array::row_kernels<N>::make_pattern(value, size);
+            return make_mask([&](const char* element) { return details::string_array::row_kernels<N>::starts_with(element, pattern); });
+        }
+    }
+
+    // Rows: `test(element)` returns whether one element matched.
+    // Column blocks: `test(block)` returns the bits of the 32 elements of a block, two blocks make a word.
+    template <typename TTest>
+    match_mask make_mask(TTest test) const
+    {
+        std::vector<std::uint64_t> words(words_for(_size));
+        for (size_t w = 0; w < words.size(); ++w)
+        {
+            const size_t  first = w * 64;
+            const size_t  count = _size - first < 64 ? _size - first : 64;
+            std::uint64_t bits = 0;
+            if constexpr (columns)
+            {
+                bits = test(block_data(first / block));
+                if (count > block)
+                    bits |= std::uint64_t(test(block_data(first / block + 1))) << block;
+            }
+            else
+            {
+                const char* element = _bytes.data() + first * N;
+                for (size_t k = 0; k < count; ++k, element += N)
+                    bits |= std::uint64_t(test(element)) << k;
+            }
+            words[w] = count == 64 ? bits : bits & ((std::uint64_t(1) << count) - 1);
+        }
+        return match_mask(std::move(words), _size);
+    }
+
+    std::vector<char> _bytes;
+    size_t            _size = 0;
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_FIXED_STRING_ARRAY_HPP
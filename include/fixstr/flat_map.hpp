@@ -0,0 +1,632 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_FLAT_MAP_HPP
+#define FIXSTR_FLAT_MAP_HPP
+
+#include "../fixed_string.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace fixstr
+{
+
+namespace details::swiss
+{
+// Control bytes: the low 7 bits of the hash of a full slot, or one of the negative markers below
+constexpr std::int8_t empty_slot = -128;
+constexpr std::int8_t deleted_slot = -2;
+constexpr size_t      group_size = 16;
+
+inline unsigned lowest_bit(unsigned value) noexcept
+{
+    return kernels::count_trailing_zeros(value);
+}
+
+// Bit `i` of every mask is set when control byte `i` of the group satisfies the condition
+#if FIXSTR_SSE2_PRESENT
+inline unsigned match(const std::int8_t* group, std::int8_t h2) noexcept
+{
+    const auto ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2))));
+}
+
+// Empty and deleted bytes are the only negative ones
+inline unsigned match_free(const std::int8_t* group) noexcept
+{
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+}
+#else
+inline unsigned match(const std::int8_t* group, std::int8_t h2) noexcept
+{
+    unsigned result = 0;
+    for (size_t i = 0; i < group_size; ++i)
+        result |= unsigned(group[i] == h2) << i;
+    return result;
+}
+
+inline unsigned match_free(const std::int8_t* group) noexcept
+{
+    unsigned result = 0;
+    for (size_t i = 0; i < group_size; ++i)
+        result |= unsigned(group[i] < 0) << i;
+    return result;
+}
+#endif // FIXSTR_SSE2_PRESENT
+
+inline unsigned match_empty(const std::int8_t* group) noexcept
+{
+    return match(group, empty_slot);
+}
+
+// The key of a lookup as N characters, or nullptr if it has a different size and cannot be in the table
+template <size_t N, typename TKey>
+const char* key_data(const TKey& key) noexcept
+{
+    if constexpr (std::is_convertible_v<const TKey&, fixed_string_view<N>>)
+        return fixed_string_view<N>(key).data();
+    else
+    {
+        const std::string_view view(key);
+        return view.size() == N ? view.data() : nullptr;
+    }
+}
+
+template <size_t N, typename TKey>
+constexpr bool is_key_v = std::is_convertible_v<const TKey&, fixed_string_view<N>> || std::is_convertible_v<const TKey&, std::string_view>;
+
+template <size_t N, typename TKey>
+const char* checked_key_data(const TKey& key)
+{
+    const char* data = key_data<N>(key);
+    if (data == nullptr)
+        throw std::length_error("fixstr::flat_map: the key size differs from the key size of the table");
+    return data;
+}
+
+// Open addressing over groups of 16 slots in the layout of Swiss tables: a control byte per slot holds 7 bits of the hash,
+// so a probe tests a whole group with one SSE2 comparison and compares keys only for matching control bytes.
+// Groups are probed triangularly and a probe ends at the first group with an empty slot.
+// TPolicy provides the slot type and `key(slot)`, which returns the fixed_string<N> of a slot.
+template <size_t N, typename TPolicy, typename THash>
+class table
+{
+  public:
+    using slot_type = typename TPolicy::slot_type;
+
+    template <bool Const>
+    class basic_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = slot_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const slot_type*, slot_type*>;
+        using reference = std::conditional_t<Const, const slot_type&, slot_type&>;
+
+        basic_iterator() = default;
+
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) noexcept : _ctrl(other._ctrl), _end(other._end), _slot(other._slot)
+        {
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return *_slot; }
+        [[nodiscard]] pointer   operator->() const noexcept { return _slot; }
+
+        basic_iterator& operator++() noexcept
+        {
+            ++_ctrl;
+            ++_slot;
+            skip_free();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs._slot == rhs._slot; }
+        [[nodiscard]] friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs._slot != rhs._slot; }
+
+      private:
+        friend class table;
+        template <bool>
+        friend class basic_iterator;
+
+        basic_iterator(const std::int8_t* ctrl, const std::int8_t* end, pointer slot) noexcept : _ctrl(ctrl), _end(end), _slot(slot) {}
+
+        void skip_free() noexcept
+        {
+            while (_ctrl != _end && *_ctrl < 0)
+            {
+                ++_ctrl;
+                ++_slot;
+            }
+        }
+
+        const std::int8_t* _ctrl = nullptr;
+        const std::int8_t* _end = nullptr;
+        pointer            _slot = nullptr;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    table() = default;
+
+    table(const table& other) : table()
+    {
+        reserve(other._size);
+        for (const auto& slot : other)
+            emplace_new(TPolicy::key(slot).data(), slot);
+    }
+
+    table(table&& other) noexcept { swap(other); }
+
+    table& operator=(table other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~table() { release(); }
+
+    void swap(table& other) noexcept
+    {
+        std::swap(_ctrl, other._ctrl);
+        std::swap(_slots, other._slots);
+        std::swap(_capacity, other._capacity);
+        std::swap(_size, other._size);
+        std::swap(_growth_left, other._growth_left);
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return _size; }
+    [[nodiscard]] bool   empty() const noexcept { return _size == 0; }
+    [[nodiscard]] size_t capacity() const noexcept { return _capacity; }
+
+    [[nodiscard]] iterator begin() noexcept
+    {
+        iterator it(_ctrl, _ctrl + _capacity, _slots);
+        it.skip_free();
+        return it;
+    }
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        const_iterator it(_ctrl, _ctrl + _capacity, _slots);
+        it.skip_free();
+        return it;
+    }
+    [[nodiscard]] iterator       end() noexcept { return iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity); }
+
+    // Makes room for `count` elements without rehashing
+    void reserve(size_t count)
+    {
+        size_t capacity = group_size;
+        while (capacity / 8 * 7 < count)
+            capacity *= 2;
+        if (capacity > _capacity)
+            rehash(capacity);
+    }
+
+    void clear() noexcept
+    {
+        for (size_t i = 0; i < _capacity; ++i)
+        {
+            if (_ctrl[i] >= 0)
+                _slots[i].~slot_type();
+            _ctrl[i] = empty_slot;
+        }
+        _size = 0;
+        _growth_left = max_load(_capacity);
+    }
+
+    // The index of the slot with the key of N characters at `key`, or _capacity
+    [[nodiscard]] size_t find_index(const char* key) const noexcept
+    {
+        if (_capacity == 0)
+            return _capacity;
+        const size_t      hash = hash_of(key);
+        const std::int8_t h2 = static_cast<std::int8_t>(hash & 0x7f);
+        const size_t      mask = _capacity / group_size - 1;
+        for (size_t group = (hash >> 7) & mask, step = 1;; group = (group + step++) & mask)
+        {
+            const std::int8_t* ctrl = _ctrl + group * group_size;
+            for (unsigned bits = match(ctrl, h2); bits != 0; bits &= bits - 1)
+            {
+                const size_t index = group * group_size + lowest_bit(bits);
+                if (fixed_equal<char, std::char_traits<char>, N>(TPolicy::key(_slots[index]).data(), key))
+                    return index;
+            }
+            if (match_empty(ctrl) != 0)
+                return _capacity;
+        }
+    }
+
+    [[nodiscard]] iterator       iterator_at(size_t index) noexcept { return iterator(_ctrl + index, _ctrl + _capacity, _slots + index); }
+    [[nodiscard]] const_iterator iterator_at(size_t index) const noexcept
+    {
+        return const_iterator(_ctrl + index, _ctrl + _capacity, _slots + index);
+    }
+
+    // Finds the key or constructs a slot for it from `args`, which are not used if the key is present
+    template <typename... TArgs>
+    std::pair<iterator, bool> try_emplace(const char* key, TArgs&&... args)
+    {
+        const size_t index = find_index(key);
+        if (index != _capacity)
+            return {iterator_at(index), false};
+        return {iterator_at(emplace_new(key, std::forward<TArgs>(args)...)), true};
+    }
+
+    void erase_at(size_t index) noexcept
+    {
+        _slots[index].~slot_type();
+        --_size;
+        // a probe never passed a group that has an empty slot, so such a slot can become empty again
+        const std::int8_t* group = _ctrl + index / group_size * group_size;
+        if (match_empty(group) != 0)
+        {
+            _ctrl[index] = empty_slot;
+            ++_growth_left;
+        }
+        else
+            _ctrl[index] = deleted_slot;
+    }
+
+    size_t erase(const char* key) noexcept
+    {
+        const size_t index = find_index(key);
+        if (index == _capacity)
+            return 0;
+        erase_at(index);
+        return 1;
+    }
+
+    [[nodiscard]] slot_type& slot(size_t index) noexcept { return _slots[index]; }
+    [[nodiscard]] const slot_type& slot(size_t index) const noexcept { return _slots[index]; }
+
+    [[nodiscard]] size_t index_of(const_iterator it) const noexcept { return static_cast<size_t>(it._slot - _slots); }
+
+  private:
+    static constexpr size_t max_load(size_t capacity) noexcept { return capacity / 8 * 7; }
+
+    static size_t hash_of(const char* key) noexcept { return THash{}(fixed_string_view<N>(key)); }
+
+    // The first free slot of the probe sequence of `hash`, the table has at least one
+    size_t find_free(size_t hash) const noexcept
+    {
+        const size_t mask = _capacity / group_size - 1;
+        for (size_t group = (hash >> 7) & mask, step = 1;; group = (group + step++) & mask)
+        {
+            if (const unsigned bits = match_free(_ctrl + group * group_size))
+                return group * group_size + lowest_bit(bits);
+        }
+    }
+
+    // Constructs a slot for a key that is not in the table
+    template <typename... TArgs>
+    size_t emplace_new(const char* key, TArgs&&... args)
+    {
+        const size_t hash = hash_of(key);
+        size_t       index = _capacity == 0 ? 0 : find_free(hash);
+        if (_capacity == 0 || (_growth_left == 0 && _ctrl[index] == empty_slot))
+        {
+            // tombstones are dropped by rehashing into the same capacity when they take more than half of the load
+            rehash(_capacity == 0 ? group_size : (_size < max_load(_capacity) / 2 ? _capacity : _capacity * 2));
+            index = find_free(hash);
+        }
+        ::new (static_cast<void*>(_slots + index)) slot_type(std::forward<TArgs>(args)...);
+        _growth_left -= _ctrl[index] == empty_slot;
+        _ctrl[index] = static_cast<std::int8_t>(hash & 0x7f);
+        ++_size;
+        return index;
+    }
+
+    void rehash(size_t capacity)
+    {
+        table result;
+        result._ctrl = new std::int8_t[capacity];
+        result._slots = std::allocator<slot_type>().allocate(capacity);
+        result._capacity = capacity;
+        std::fill_n(result._ctrl, capacity, empty_slot);
+        result._growth_left = max_load(capacity);
+        for (size_t i = 0; i < _capacity; ++i)
+        {
+            if (_ctrl[i] < 0)
+                continue;
+            const size_t hash = hash_of(TPolicy::key(_slots[i]).data());
+            const size_t index = result.find_free(hash);
+            ::new (static_cast<void*>(result._slots + index)) slot_type(std::move_if_noexcept(_slots[i]));
+            result._ctrl[index] = static_cast<std::int8_t>(hash & 0x7f);
+            --result._growth_left;
+        }
+        result._size = _size;
+        swap(result);
+    }
+
+    void release() noexcept
+    {
+        if (_capacity == 0)
+            return;
+        for (size_t i = 0; i < _capacity; ++i)
+        {
+            if (_ctrl[i] >= 0)
+                _slots[i].~slot_type();
+        }
+        std::allocator<slot_type>().deallocate(_slots, _capacity);
+        delete[] _ctrl;
+    }
+
+    std::int8_t* _ctrl = nullptr;
+    slot_type*   _slots = nullptr;
+    size_t       _capacity = 0;
+    size_t       _size = 0;
+    size_t       _growth_left = 0;
+};
+
+template <size_t N, typename TValue>
+struct map_policy
+{
+    using slot_type = std::pair<const fixed_string<N>, TValue>;
+    static const fixed_string<N>& key(const slot_type& slot) noexcept { return slot.first; }
+};
+
+template <size_t N>
+struct set_policy
+{
+    using slot_type = fixed_string<N>;
+    static const fixed_string<N>& key(const slot_type& slot) noexcept { return slot; }
+};
+} // namespace details::swiss
+
+// A hash map with fixed_string<N> keys stored inline, next to their values, in a flat Swiss-table layout.
+// Keys are compared with the fixed-size comparison kernels and lookups accept anything convertible to std::string_view
+// without constructing a key: a key of another size is simply not found.
+// Insertions may rehash and invalidate iterators and references, erasure invalidates only the erased element.
+template <size_t N, typename TValue, typename THash = hash>
+class flat_map
+{
+    using table_type = details::swiss::table<N, details::swiss::map_policy<N, TValue>, THash>;
+
+  public:
+    using key_type = fixed_string<N>;
+    using mapped_type = TValue;
+    using value_type = std::pair<const fixed_string<N>, TValue>;
+    using size_type = size_t;
+    using hasher = THash;
+    using iterator = typename table_type::iterator;
+    using const_iterator = typename table_type::const_iterator;
+
+    flat_map() = default;
+
+    flat_map(std::initializer_list<value_type> values)
+    {
+        reserve(values.size());
+        for (const auto& value : values)
+            insert(value);
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return _table.size(); }
+    [[nodiscard]] bool   empty() const noexcept { return _table.empty(); }
+    [[nodiscard]] size_t capacity() const noexcept { return _table.capacity(); }
+
+    void reserve(size_t count) { _table.reserve(count); }
+    void clear() noexcept { _table.clear(); }
+
+    [[nodiscard]] iterator       begin() noexcept { return _table.begin(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return _table.begin(); }
+    [[nodiscard]] iterator       end() noexcept { return _table.end(); }
+    [[nodiscard]] const_iterator end() const noexcept { return _table.end(); }
+
+    // Lookups accept fixed strings of N characters and everything convertible to std::string_view
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] iterator find(const TKey& key) noexcept
+    {
+        const char* data = details::swiss::key_data<N>(key);
+        return data == nullptr ? end() : _table.iterator_at(_table.find_index(data));
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] const_iterator find(const TKey& key) const noexcept
+    {
+        const char* data = details::swiss::key_data<N>(key);
+        return data == nullptr ? end() : _table.iterator_at(_table.find_index(data));
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] bool contains(const TKey& key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] size_t count(const TKey& key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    // Throws std::out_of_range if the key is absent
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] TValue& at(const TKey& key)
+    {
+        const auto it = find(key);
+        if (it == end())
+            throw std::out_of_range("fixstr::flat_map::at: the key is absent");
+        return it->second;
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] const TValue& at(const TKey& key) const
+    {
+        const auto it = find(key);
+        if (it == end())
+            throw std::out_of_range("fixstr::flat_map::at: the key is absent");
+        return it->second;
+    }
+
+    // Insertions throw std::length_error for keys that are not N characters long
+    template <typename TKey, typename... TArgs, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    std::pair<iterator, bool> try_emplace(const TKey& key, TArgs&&... args)
+    {
+        const char* data = details::swiss::checked_key_data<N>(key);
+        return _table.try_emplace(data, std::piecewise_construct, std::forward_as_tuple(fixed_string_view<N>(data)),
+                                  std::forward_as_tuple(std::forward<TArgs>(args)...));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(value.first, std::move(value.second)); }
+
+    template <typename TKey, typename TMapped, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    std::pair<iterator, bool> insert_or_assign(const TKey& key, TMapped&& value)
+    {
+        auto result = try_emplace(key, std::forward<TMapped>(value));
+        if (!result.second)
+            result.first->second = std::forward<TMapped>(value);
+        return result;
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    TValue& operator[](const TKey& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    size_t erase(const TKey& key) noexcept
+    {
+        const char* data = details::swiss::key_data<N>(key);
+        return data == nullptr ? 0 : _table.erase(data);
+    }
+
+    // Returns the iterator following the erased element
+    iterator erase(const_iterator position) noexcept
+    {
+        const size_t index = _table.index_of(position);
+        _table.erase_at(index);
+        return ++_table.iterator_at(index);
+    }
+
+    void swap(flat_map& other) noexcept { _table.swap(other._table); }
+
+  private:
+    table_type _table;
+};
+
+// A hash set of fixed_string<N> in the layout of flat_map
+template <size_t N, typename THash = hash>
+class flat_set
+{
+    using table_type = details::swiss::table<N, details::swiss::set_policy<N>, THash>;
+
+  public:
+    using key_type = fixed_string<N>;
+    using value_type = fixed_string<N>;
+    using size_type = size_t;
+    using hasher = THash;
+    using iterator = typename table_type::const_iterator;
+    using const_iterator = typename table_type::const_iterator;
+
+    flat_set() = default;
+
+    flat_set(std::initializer_list<fixed_string_view<N>> values)
+    {
+        reserve(values.size());
+        for (const auto value : values)
+            insert(value);
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return _table.size(); }
+    [[nodiscard]] bool   empty() const noexcept { return _table.empty(); }
+    [[nodiscard]] size_t capacity() const noexcept { return _table.capacity(); }
+
+    void reserve(size_t count) { _table.reserve(count); }
+    void clear() noexcept { _table.clear(); }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return _table.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return _table.end(); }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] const_iterator find(const TKey& key) const noexcept
+    {
+        const char* data = details::swiss::key_data<N>(key);
+        return data == nullptr ? end() : _table.iterator_at(_table.find_index(data));
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] bool contains(const TKey& key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    [[nodiscard]] size_t count(const TKey& key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    // Throws std::length_error for keys that are not N characters long
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    std::pair<const_iterator, bool> insert(const TKey& key)
+    {
+        const char* data = details::swiss::checked_key_data<N>(key);
+        const auto  result = _table.try_emplace(data, fixed_string_view<N>(data));
+        return {result.first, result.second};
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::swiss::is_key_v<N, TKey>>>
+    size_t erase(const TKey& key) noexcept
+    {
+        const char* data = details::swiss::key_data<N>(key);
+        return data == nullptr ? 0 : _table.erase(data);
+    }
+
+    const_iterator erase(const_iterator position) noexcept
+    {
+        const size_t index = _table.index_of(position);
+        _table.erase_at(index);
+        return ++_table.iterator_at(index);
+    }
+
+    void swap(flat_set& other) noexcept { _table.swap(other._table); }
+
+  private:
+    table_type _table;
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_FLAT_MAP_HPP
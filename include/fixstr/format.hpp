@@ -0,0 +1,719 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_FORMAT_HPP
+#define FIXSTR_FORMAT_HPP
+
+#include "../fixed_string.hpp"
+#include "inplace_string.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#if __cpp_nontype_template_args >= 201911
+#include <bit>
+#endif
+
+#if __cpp_nontype_template_args >= 201911 && __cpp_lib_bit_cast >= 201806
+#define FIXSTR_FLOATING_POINT_NTTP_PRESENT 1
+#else
+#define FIXSTR_FLOATING_POINT_NTTP_PRESENT 0
+#endif // FIXSTR_FLOATING_POINT_NTTP_PRESENT
+
+namespace fixstr
+{
+namespace details::formatting
+{
+template <typename T>
+inline constexpr bool is_character_v = std::is_same_v<T, char> || std::is_same_v<T, wchar_t> ||
+#if FIXSTR_CPP20_CHAR8T_PRESENT
+                                       std::is_same_v<T, char8_t> ||
+#endif
+                                       std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+// A number in positional notation: 0.d1d2...dn * 10^point
+struct decimal
+{
+    // Enough for the integral digits of the largest double
+    static constexpr size_t max_digits = std::numeric_limits<double>::max_exponent10 + 1;
+
+    bool                         negative = false;
+    std::array<char, max_digits> digits{};
+    size_t               digit_count = 0;
+    std::ptrdiff_t       point = 0;
+};
+
+constexpr size_t length_of(const decimal& value) noexcept
+{
+    const auto digits = static_cast<std::ptrdiff_t>(value.digit_count);
+    if (value.point <= 0)
+        return value.negative + 2 + static_cast<size_t>(-value.point) + value.digit_count;
+    return value.negative + static_cast<size_t>(value.point >= digits ? value.point : digits + 1);
+}
+
+template <typename T>
+constexpr decimal integer_decimal(T value) noexcept
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    decimal result;
+    result.negative = value < 0;
+    unsigned_type magnitude = result.negative ? static_cast<unsigned_type>(unsigned_type(0) - static_cast<unsigned_type>(value)) : static_cast<unsigned_type>(value);
+    do
+    {
+        result.digits[result.digit_count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    for (size_t i = 0; i < result.digit_count / 2; ++i)
+    {
+        const auto digit = result.digits[i];
+        result.digits[i] = result.digits[result.digit_count - 1 - i];
+        result.digits[result.digit_count - 1 - i] = digit;
+    }
+    result.point = static_cast<std::ptrdiff_t>(result.digit_count);
+    return result;
+}
+
+#if FIXSTR_FLOATING_POINT_NTTP_PRESENT
+// Unsigned integer wide enough for every intermediate value of `shortest_digits` for doubles.
+// Only the limbs in use are touched, which keeps constant evaluation of typical values cheap.
+class big_integer
+{
+  public:
+    constexpr explicit big_integer(std::uint64_t value = 0) noexcept
+    {
+        _limbs[0] = static_cast<std::uint32_t>(value);
+        _limbs[1] = static_cast<std::uint32_t>(value >> 32);
+        _size = 2;
+        trim();
+    }
+
+    constexpr big_integer& shift_left(size_t bits) noexcept
+    {
+        const size_t limbs = bits / 32;
+        const size_t rest = bits % 32;
+        const size_t size = std::min(limb_count, _size + limbs + 1);
+        for (size_t i = size; i-- > 0;)
+        {
+            std::uint64_t value = i >= limbs ? std::uint64_t(_limbs[i - limbs]) << rest : 0;
+            if (rest != 0 && i > limbs)
+                value |= _limbs[i - limbs - 1] >> (32 - rest);
+            _limbs[i] = static_cast<std::uint32_t>(value);
+        }
+        _size = size;
+        trim();
+        return *this;
+    }
+
+    constexpr big_integer& multiply(std::uint32_t factor) noexcept
+    {
+        std::uint64_t carry = 0;
+        for (size_t i = 0; i < _size; ++i)
+        {
+            carry += std::uint64_t(_limbs[i]) * factor;
+            _limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        if (carry != 0)
+            _limbs[_size++] = static_cast<std::uint32_t>(carry);
+        return *this;
+    }
+
+    constexpr big_integer& operator+=(const big_integer& other) noexcept
+    {
+        const size_t  size = std::max(_size, other._size);
+        std::uint64_t carry = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            carry += std::uint64_t(_limbs[i]) + other._limbs[i];
+            _limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        _size = size;
+        if (carry != 0)
+            _limbs[_size++] = static_cast<std::uint32_t>(carry);
+        return *this;
+    }
+
+    // Requires *this >= other
+    constexpr big_integer& operator-=(const big_integer& other) noexcept
+    {
+        std::uint64_t borrow = 0;
+        for (size_t i = 0; i < _size; ++i)
+        {
+            const std::uint64_t subtrahend = std::uint64_t(other._limbs[i]) + borrow;
+            borrow = _limbs[i] < subtrahend;
+            _limbs[i] = static_cast<std::uint32_t>(std::uint64_t(_limbs[i]) - subtrahend);
+        }
+        trim();
+        return *this;
+    }
+
+    // Divides in place and returns the remainder
+    constexpr std::uint32_t divide(std::uint32_t divisor) noexcept
+    {
+        std::uint64_t remainder = 0;
+        for (size_t i = _size; i-- > 0;)
+        {
+            remainder = remainder << 32 | _limbs[i];
+            _limbs[i] = static_cast<std::uint32_t>(remainder / divisor);
+            remainder %= divisor;
+        }
+        trim();
+        return static_cast<std::uint32_t>(remainder);
+    }
+
+    constexpr bool is_zero() const noexcept { return _size == 0; }
+
+    friend constexpr int compare(const big_integer& lhs, const big_integer& rhs) noexcept
+    {
+        if (lhs._size != rhs._size)
+            return lhs._size < rhs._size ? -1 : 1;
+        for (size_t i = lhs._size; i-- > 0;)
+            if (lhs._limbs[i] != rhs._limbs[i])
+                return lhs._limbs[i] < rhs._limbs[i] ? -1 : 1;
+        return 0;
+    }
+
+    friend constexpr big_integer operator+(big_integer lhs, const big_integer& rhs) noexcept { return lhs += rhs; }
+
+  private:
+    constexpr void trim() noexcept
+    {
+        while (_size > 0 && _limbs[_size - 1] == 0)
+            --_size;
+    }
+
+    // 2^1076 * 10 * 10 plus margin, the largest intermediate value for subnormal doubles
+    static constexpr size_t limb_count = 36;
+
+    std::array<std::uint32_t, limb_count> _limbs{};
+    size_t                                _size = 0;
+};
+
+// Free-format shortest digit generation (Steele & White, Burger & Dybvig) in exact arithmetic:
+// produces the fewest digits that read back as `mantissa * 2^exponent`
+constexpr void shortest_digits(decimal& result, std::uint64_t mantissa, int exponent, bool lower_boundary_is_closer)
+{
+    constexpr std::uint32_t chunk = 1'000'000'000;
+    constexpr int           chunk_digits = 9;
+
+    const bool  inclusive = mantissa % 2 == 0;
+    big_integer r(mantissa), s(1), m_plus(1), m_minus(1);
+    if (exponent >= 0)
+    {
+        r.shift_left(static_cast<size_t>(exponent) + 1 + lower_boundary_is_closer);
+        s.shift_left(1 + lower_boundary_is_closer);
+        m_plus.shift_left(static_cast<size_t>(exponent) + lower_boundary_is_closer);
+        m_minus.shift_left(static_cast<size_t>(exponent));
+    }
+    else
+    {
+        r.shift_left(1 + lower_boundary_is_closer);
+        s.shift_left(static_cast<size_t>(-exponent) + 1 + lower_boundary_is_closer);
+        m_plus.shift_left(lower_boundary_is_closer);
+    }
+
+    // The high boundary r + m+ reaches `limit`
+    const auto reaches = [inclusive](const big_integer& high, const big_integer& limit) {
+        const int order = compare(high, limit);
+        return inclusive ? order >= 0 : order > 0;
+    };
+    const auto scale_up = [&](std::uint32_t factor) {
+        r.multiply(factor);
+        m_plus.multiply(factor);
+        m_minus.multiply(factor);
+    };
+
+    // Scale so that the high boundary lies in [s / 10, s), by whole chunks of digits first
+    std::ptrdiff_t point = 0;
+    while (reaches(r + m_plus, big_integer(s).multiply(chunk)))
+    {
+        s.multiply(chunk);
+        point += chunk_digits;
+    }
+    while (reaches(r + m_plus, s))
+    {
+        s.multiply(10);
+        ++point;
+    }
+    while (!reaches((r + m_plus).multiply(chunk).multiply(10), s))
+    {
+        scale_up(chunk);
+        point -= chunk_digits;
+    }
+    while (!reaches((r + m_plus).multiply(10), s))
+    {
+        scale_up(10);
+        --point;
+    }
+    result.point = point;
+
+    while (true)
+    {
+        scale_up(10);
+        char digit = 0;
+        while (compare(r, s) >= 0)
+        {
+            r -= s;
+            ++digit;
+        }
+        const int  low_order = compare(r, m_minus);
+        const bool low = inclusive ? low_order <= 0 : low_order < 0;
+        const bool high = reaches(r + m_plus, s);
+        if (low && (!high || compare(r + r, s) < 0))
+        {
+            result.digits[result.digit_count++] = static_cast<char>('0' + digit);
+            return;
+        }
+        if (high)
+        {
+            result.digits[result.digit_count++] = static_cast<char>('0' + digit + 1);
+            return;
+        }
+        result.digits[result.digit_count++] = static_cast<char>('0' + digit);
+    }
+}
+
+// Whole numbers whose shortest digits end before the decimal point are printed exactly, like std::to_chars does
+constexpr void exact_integer_digits(decimal& result, std::uint64_t mantissa, int exponent) noexcept
+{
+    big_integer value(exponent >= 0 ? mantissa : mantissa >> -exponent);
+    if (exponent > 0)
+        value.shift_left(static_cast<size_t>(exponent));
+
+    result.digit_count = 0;
+    while (!value.is_zero())
+    {
+        auto chunk = value.divide(1'000'000'000);
+        for (int i = 0; i < 9 && (chunk != 0 || !value.is_zero()); ++i, chunk /= 10)
+            result.digits[result.digit_count++] = static_cast<char>('0' + chunk % 10);
+    }
+    for (size_t i = 0; i < result.digit_count / 2; ++i)
+    {
+        const auto digit = result.digits[i];
+        result.digits[i] = result.digits[result.digit_count - 1 - i];
+        result.digits[result.digit_count - 1 - i] = digit;
+    }
+    result.point = static_cast<std::ptrdiff_t>(result.digit_count);
+}
+
+template <typename T>
+constexpr decimal floating_point_decimal(T value)
+{
+    using bits_type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+    constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+    constexpr int exponent_bias = std::numeric_limits<T>::max_exponent - 1 + mantissa_bits;
+
+    const auto bits = std::bit_cast<bits_type>(value);
+    const auto biased_exponent = static_cast<int>(bits >> mantissa_bits & ((bits_type(1) << (sizeof(T) * 8 - 1 - mantissa_bits)) - 1));
+    if (biased_exponent == (std::numeric_limits<T>::max_exponent - std::numeric_limits<T>::min_exponent + 2))
+        throw std::invalid_argument("fixstr::to_fixed_string: value is not finite");
+
+    decimal result;
+    result.negative = (bits >> (sizeof(T) * 8 - 1)) != 0;
+    const std::uint64_t fraction = bits & ((bits_type(1) << mantissa_bits) - 1);
+    if (biased_exponent == 0 && fraction == 0)
+    {
+        result.digits[0] = '0';
+        result.digit_count = 1;
+        result.point = 1;
+        return result;
+    }
+
+    const auto mantissa = biased_exponent == 0 ? fraction : fraction | std::uint64_t(1) << mantissa_bits;
+    const int  exponent = (biased_exponent == 0 ? 1 : biased_exponent) - exponent_bias;
+    shortest_digits(result, mantissa, exponent, fraction == 0 && biased_exponent > 1);
+    if (result.point > static_cast<std::ptrdiff_t>(result.digit_count))
+        exact_integer_digits(result, mantissa, exponent);
+    return result;
+}
+#endif // FIXSTR_FLOATING_POINT_NTTP_PRESENT
+
+template <auto Value>
+constexpr decimal decimal_of()
+{
+    using value_type = decltype(Value);
+    static_assert(std::is_arithmetic_v<value_type>, "only arithmetic values can be converted");
+    static_assert(!is_character_v<value_type>, "characters are not numbers, use them as they are");
+    if constexpr (std::is_integral_v<value_type>)
+        return integer_decimal(Value);
+#if FIXSTR_FLOATING_POINT_NTTP_PRESENT
+    else
+    {
+        static_assert(std::is_same_v<value_type, float> || std::is_same_v<value_type, double>, "only float and double are supported");
+        return floating_point_decimal(Value);
+    }
+#endif // FIXSTR_FLOATING_POINT_NTTP_PRESENT
+}
+
+template <typename TChar, size_t N>
+constexpr basic_fixed_string<TChar, N - 1> widen(const char (&str)[N]) noexcept
+{
+    basic_fixed_string<TChar, N - 1> result;
+    for (size_t i = 0; i < N - 1; ++i)
+        result[i] = TChar(str[i]);
+    return result;
+}
+} // namespace details::formatting
+
+// Converts an integral or, since C++20, a floating-point constant to the fixed string of its exact length.
+// Floating-point values use the shortest fixed-point notation that reads back as the same value, as std::to_chars does.
+template <auto Value, typename TChar = char>
+[[nodiscard]] constexpr auto to_fixed_string() noexcept
+{
+    using value_type = decltype(Value);
+    if constexpr (std::is_same_v<value_type, bool>)
+    {
+        if constexpr (Value)
+            return details::formatting::widen<TChar>("true");
+        else
+            return details::formatting::widen<TChar>("false");
+    }
+    else
+    {
+        constexpr auto value = details::formatting::decimal_of<Value>();
+
+        basic_fixed_string<TChar, details::formatting::length_of(value)> result;
+        auto                                                             out = result.begin();
+        if (value.negative)
+            *out++ = TChar('-');
+        if (value.point <= 0)
+        {
+            *out++ = TChar('0');
+            *out++ = TChar('.');
+            details::fill(out, out - value.point, TChar('0'));
+            out -= value.point;
+        }
+        for (size_t i = 0; i < value.digit_count; ++i)
+        {
+            if (value.point > 0 && i == static_cast<size_t>(value.point))
+                *out++ = TChar('.');
+            *out++ = TChar(value.digits[i]);
+        }
+        if (value.point > static_cast<std::ptrdiff_t>(value.digit_count))
+            details::fill(out, out + (value.point - static_cast<std::ptrdiff_t>(value.digit_count)), TChar('0'));
+        return result;
+    }
+}
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+namespace details::formatting
+{
+// "{}" is a placeholder, "{{" and "}}" are escaped braces
+struct format_layout
+{
+    size_t literal_size = 0;
+    size_t placeholders = 0;
+};
+
+template <typename TChar, size_t N, typename TTraits>
+constexpr format_layout parse(const basic_fixed_string<TChar, N, TTraits>& format)
+{
+    format_layout result;
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (format[i] != TChar('{') && format[i] != TChar('}'))
+        {
+            ++result.literal_size;
+            continue;
+        }
+        if (i + 1 == N)
+            throw std::invalid_argument("fixstr::format: unmatched brace in the format string");
+        if (format[i] == TChar('{') && format[i + 1] == TChar('}'))
+            ++result.placeholders;
+        else if (format[i] == format[i + 1])
+            ++result.literal_size;
+        else
+            throw std::invalid_argument("fixstr::format: only \"{}\" placeholders are supported");
+        ++i;
+    }
+    return result;
+}
+
+template <basic_fixed_string Format, typename... TArgs>
+constexpr auto format(const TArgs&... args) noexcept
+{
+    using char_type = typename std::remove_cv_t<decltype(Format)>::value_type;
+    constexpr auto layout = parse(Format);
+    static_assert(layout.placeholders == sizeof...(TArgs), "the number of arguments must match the number of placeholders");
+
+    using result_type = typename concat_result<concat_operand<char_type, layout.literal_size, void>, concat_operand_t<TArgs>...>::type;
+    const std::array<const char_type*, sizeof...(TArgs)> arg_data = {concat_data(args)...};
+    constexpr std::array<size_t, sizeof...(TArgs)>       arg_sizes = {concat_operand_t<TArgs>::size...};
+
+    result_type result;
+    auto        out = result.begin();
+    size_t      arg = 0;
+    for (size_t i = 0; i < Format.size(); ++i)
+    {
+        if (Format[i] == char_type('{') && Format[i + 1] == char_type('}'))
+        {
+            out = copy(arg_data[arg], arg_data[arg] + arg_sizes[arg], out);
+            ++arg;
+            ++i;
+            continue;
+        }
+        *out++ = Format[i];
+        if (Format[i] == char_type('{') || Format[i] == char_type('}'))
+            ++i;
+    }
+    return result;
+}
+
+template <typename TChar, auto Arg>
+constexpr auto format_argument() noexcept
+{
+    using arg_type = decltype(Arg);
+    if constexpr (std::is_arithmetic_v<arg_type> && !is_character_v<arg_type>)
+        return to_fixed_string<Arg, TChar>();
+    else
+        return Arg;
+}
+} // namespace details::formatting
+
+// Substitutes "{}" placeholders with fixed strings, string literals or characters; the result has exactly the formatted length
+template <basic_fixed_string Format, typename... TArgs>
+    requires(sizeof...(TArgs) > 0)
+[[nodiscard]] constexpr auto format(const TArgs&... args) noexcept
+{
+    return details::formatting::format<Format>(args...);
+}
+
+// Substitutes "{}" placeholders with constants: numbers are converted with `to_fixed_string`,
+// characters and fixed strings are inserted as they are
+template <basic_fixed_string Format, auto... Args>
+[[nodiscard]] constexpr auto format() noexcept
+{
+    using char_type = typename std::remove_cv_t<decltype(Format)>::value_type;
+    return details::formatting::format<Format>(details::formatting::format_argument<char_type, Args>()...);
+}
+
+namespace details::formatting
+{
+// Literal text of a format string with the escapes resolved; placeholder `i` sits between segments `i` and `i + 1`
+template <basic_fixed_string Format>
+struct compiled_format
+{
+    using char_type = typename std::remove_cv_t<decltype(Format)>::value_type;
+    static constexpr format_layout layout = parse(Format);
+
+    struct segments_type
+    {
+        basic_fixed_string<char_type, layout.literal_size> text;
+        std::array<size_t, layout.placeholders + 2>        bounds{};
+    };
+
+    static constexpr segments_type segments = [] {
+        segments_type result;
+        size_t        size = 0;
+        size_t        placeholder = 0;
+        for (size_t i = 0; i < Format.size(); ++i)
+        {
+            if (Format[i] == char_type('{') && Format[i + 1] == char_type('}'))
+            {
+                result.bounds[++placeholder] = size;
+                ++i;
+                continue;
+            }
+            result.text[size++] = Format[i];
+            if (Format[i] == char_type('{') || Format[i] == char_type('}'))
+                ++i;
+        }
+        result.bounds[placeholder + 1] = size;
+        return result;
+    }();
+};
+
+template <typename T, typename = void>
+struct has_static_size : std::false_type
+{
+};
+
+template <typename T>
+struct has_static_size<T, std::void_t<concat_operand_t<T>>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool dependent_false_v = false;
+
+// Characters and strings are copied verbatim, so their character type must be the one of the format
+template <typename TChar, typename T>
+constexpr bool has_format_char_type() noexcept
+{
+    if constexpr (is_character_v<T>)
+        return std::is_same_v<T, TChar>;
+    else if constexpr (std::is_arithmetic_v<T>)
+        return true;
+    else if constexpr (is_inplace_string<T>::value)
+        return std::is_same_v<typename T::value_type, TChar>;
+    else if constexpr (has_static_size<T>::value)
+        return std::is_same_v<typename concat_operand_t<T>::char_type, TChar>;
+    else
+        return true;
+}
+
+template <typename TChar, typename T>
+inline constexpr bool has_format_char_type_v = has_format_char_type<TChar, T>();
+
+// The longest output of an argument of type T
+template <typename TChar, typename T>
+constexpr size_t max_argument_size() noexcept
+{
+    static_assert(has_format_char_type_v<TChar, T>, "character and string arguments must have the character type of the format");
+    if constexpr (std::is_same_v<T, TChar>)
+        return 1;
+    else if constexpr (std::is_same_v<T, bool>)
+        return 5;
+    else if constexpr (std::is_integral_v<T> && !is_character_v<T>)
+        return std::numeric_limits<T>::digits10 + 1 + std::is_signed_v<T>;
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "only float and double are supported");
+        // Sign, significant digits, point and exponent, as in "-2.2250738585072014e-308"
+        return 1 + std::numeric_limits<T>::max_digits10 + 1 + 2 + (std::numeric_limits<T>::max_exponent10 >= 100 ? 3 : 2);
+    }
+    else if constexpr (is_inplace_string<T>::value)
+        return T::capacity();
+    else if constexpr (has_static_size<T>::value)
+        return concat_operand_t<T>::size;
+    else
+        static_assert(dependent_false_v<T>, "arguments must have a bounded length: use numbers, characters, fixed strings or inplace strings");
+}
+
+template <typename TChar, typename T>
+TChar* write_argument(TChar* out, const T& value) noexcept
+{
+    static_assert(has_format_char_type_v<TChar, T>, "character and string arguments must have the character type of the format");
+    if constexpr (std::is_same_v<T, TChar>)
+    {
+        *out = value;
+        return out + 1;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        static constexpr auto true_text = widen<TChar>("true");
+        static constexpr auto false_text = widen<TChar>("false");
+        return value ? write_argument(out, true_text) : write_argument(out, false_text);
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+#if !defined(__cpp_lib_to_chars)
+        static_assert(std::is_integral_v<T>, "the standard library does not support floating-point std::to_chars");
+#endif
+        constexpr size_t max_size = max_argument_size<TChar, T>();
+        if constexpr (std::is_same_v<TChar, char>)
+            return std::to_chars(out, out + max_size, value).ptr;
+        else
+        {
+            char       buffer[max_size];
+            const auto end = std::to_chars(buffer, buffer + max_size, value).ptr;
+            for (const char* it = buffer; it != end; ++it)
+                *out++ = TChar(*it);
+            return out;
+        }
+    }
+    else if constexpr (is_inplace_string<T>::value)
+    {
+        std::memcpy(out, value.data(), value.size() * sizeof(TChar));
+        return out + value.size();
+    }
+    else
+    {
+        constexpr size_t size = concat_operand_t<T>::size;
+        std::memcpy(out, concat_data(value), size * sizeof(TChar));
+        return out + size;
+    }
+}
+
+template <typename TCompiled, size_t I, typename TChar>
+TChar* write_segment(TChar* out) noexcept
+{
+    constexpr size_t begin = TCompiled::segments.bounds[I];
+    constexpr size_t size = TCompiled::segments.bounds[I + 1] - begin;
+    if constexpr (size != 0)
+        std::memcpy(out, TCompiled::segments.text.data() + begin, size * sizeof(TChar));
+    return out + size;
+}
+
+template <typename TCompiled, typename TChar, size_t... Is, typename... TArgs>
+TChar* format_segments(TChar* out, std::index_sequence<Is...>, const TArgs&... args) noexcept
+{
+    ((out = write_segment<TCompiled, Is>(out), out = write_argument(out, args)), ...);
+    return write_segment<TCompiled, sizeof...(Is)>(out);
+}
+} // namespace details::formatting
+
+// The longest output of `format_to<Format>` for arguments of the given types
+template <basic_fixed_string Format, typename... TArgs>
+inline constexpr size_t max_formatted_size_v =
+    details::formatting::parse(Format).literal_size +
+    (size_t(0) + ... +
+     details::formatting::max_argument_size<typename std::remove_cv_t<decltype(Format)>::value_type, std::remove_cv_t<std::remove_reference_t<TArgs>>>());
+
+// Substitutes "{}" placeholders with runtime values. The format string is split at compile time,
+// so the work left is copying the literal segments and converting the arguments.
+// Arguments are characters, bool, integers, float and double (shortest representation, as std::to_chars),
+// fixed strings, string literals and inplace strings.
+// `out` must have room for `max_formatted_size_v<Format, TArgs...>` characters; returns the end of the output.
+template <basic_fixed_string Format, typename TChar, typename... TArgs>
+TChar* format_to(TChar* out, const TArgs&... args) noexcept
+{
+    using compiled = details::formatting::compiled_format<Format>;
+    static_assert(std::is_same_v<TChar, typename compiled::char_type>, "the output must have the character type of the format string");
+    static_assert(compiled::layout.placeholders == sizeof...(TArgs), "the number of arguments must match the number of placeholders");
+    return details::formatting::format_segments<compiled>(out, std::index_sequence_for<TArgs...>{}, args...);
+}
+
+// Appends the formatted text. Throws std::length_error unless the remaining capacity fits `max_formatted_size_v<Format, TArgs...>`
+template <basic_fixed_string Format, typename TChar, size_t Capacity, typename TTraits, typename... TArgs>
+void format_to(basic_inplace_string<TChar, Capacity, TTraits>& out, const TArgs&... args)
+{
+    constexpr size_t max_size = max_formatted_size_v<Format, TArgs...>;
+    static_assert(max_size <= Capacity, "the capacity is not enough for the formatted text");
+    const auto old_size = out.size();
+    if (Capacity - old_size < max_size)
+        throw std::length_error("fixstr::format_to: not enough capacity");
+    out.resize_and_overwrite(old_size + max_size, [&](TChar* data, size_t) { return static_cast<size_t>(format_to<Format>(data + old_size, args...) - data); });
+}
+
+// Formats into an inplace string whose capacity is the longest possible output
+template <basic_fixed_string Format, typename... TArgs>
+[[nodiscard]] auto format_inplace(const TArgs&... args) noexcept
+{
+    basic_inplace_string<typename std::remove_cv_t<decltype(Format)>::value_type, max_formatted_size_v<Format, TArgs...>> result;
+    result.resize_and_overwrite(result.capacity(), [&](auto* data, size_t) { return static_cast<size_t>(format_to<Format>(data, args...) - data); });
+    return result;
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+} // namespace fixstr
+
+#endif // FIXSTR_FORMAT_HPP
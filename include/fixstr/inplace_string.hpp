@@ -0,0 +1,647 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_INPLACE_STRING_HPP
+#define FIXSTR_INPLACE_STRING_HPP
+
+#include "../fixed_string.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace fixstr
+{
+
+namespace details
+{
+template <size_t Capacity>
+using inplace_size_type = std::conditional_t<
+    Capacity <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+    std::conditional_t<Capacity <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+                       std::conditional_t<Capacity <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, size_t>>>;
+
+template <typename BidirectionalIterator>
+constexpr void reverse(BidirectionalIterator first, BidirectionalIterator last)
+{
+    while (first != last && first != --last)
+    {
+        const auto tmp = *first;
+        *first++ = *last;
+        *last = tmp;
+    }
+}
+} // namespace details
+
+// String with a fixed capacity and a variable size that never allocates.
+// Characters past `size()` are always zero, so `c_str()` is available and equal strings have equal object representations.
+template <typename TChar, std::size_t Capacity, typename TTraits = std::char_traits<TChar>>
+struct basic_inplace_string
+{
+    // exposition only
+    using storage_type = std::array<TChar, Capacity + 1>;
+    storage_type                         _data{};
+    details::inplace_size_type<Capacity> _size{};
+
+    using traits_type = TTraits;
+    using value_type = TChar;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using string_view_type = std::basic_string_view<value_type, traits_type>;
+    static constexpr auto npos = string_view_type::npos;
+
+    constexpr basic_inplace_string() noexcept = default;
+
+    template <size_t N>
+    constexpr basic_inplace_string(const value_type (&array)[N]) noexcept // NOLINT(google-explicit-constructor)
+    {
+        static_assert(N - 1 <= Capacity, "string literal does not fit into basic_inplace_string");
+        unchecked_assign(string_view_type(array, N - 1));
+    }
+
+    template <size_t N>
+    constexpr basic_inplace_string(const basic_fixed_string<value_type, N, traits_type>& str) noexcept // NOLINT(google-explicit-constructor)
+    {
+        static_assert(N <= Capacity, "basic_fixed_string does not fit into basic_inplace_string");
+        unchecked_assign(str);
+    }
+
+    template <size_t OtherCapacity, std::enable_if_t<(OtherCapacity <= Capacity), int> = 0>
+    constexpr basic_inplace_string(const basic_inplace_string<value_type, OtherCapacity, traits_type>& other) noexcept // NOLINT(google-explicit-constructor)
+    {
+        unchecked_assign(other);
+    }
+
+    // Throws std::length_error if `other` does not fit
+    template <size_t OtherCapacity, std::enable_if_t<(OtherCapacity > Capacity), int> = 0>
+    explicit constexpr basic_inplace_string(const basic_inplace_string<value_type, OtherCapacity, traits_type>& other)
+    {
+        assign(other);
+    }
+
+    // Throws std::length_error if `sv` does not fit
+    explicit constexpr basic_inplace_string(string_view_type sv) { assign(sv); }
+
+    // Throws std::length_error if `count` exceeds the capacity
+    constexpr basic_inplace_string(size_type count, value_type ch) { assign(count, ch); }
+
+    // Keeps as many leading characters of `sv` as fit
+    [[nodiscard]] static constexpr basic_inplace_string truncate(string_view_type sv) noexcept
+    {
+        basic_inplace_string result;
+        result.unchecked_assign(sv.substr(0, std::min(sv.size(), Capacity)));
+        return result;
+    }
+
+    // iterators
+    [[nodiscard]] constexpr iterator               begin() noexcept { return _data.begin(); }
+    [[nodiscard]] constexpr const_iterator         begin() const noexcept { return _data.begin(); }
+    [[nodiscard]] constexpr iterator               end() noexcept { return _data.begin() + size(); }
+    [[nodiscard]] constexpr const_iterator         end() const noexcept { return _data.begin() + size(); }
+    [[nodiscard]] constexpr const_iterator         cbegin() const noexcept { return begin(); }
+    [[nodiscard]] constexpr const_iterator         cend() const noexcept { return end(); }
+    [[nodiscard]] constexpr reverse_iterator       rbegin() noexcept { return reverse_iterator(end()); }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    [[nodiscard]] constexpr reverse_iterator       rend() noexcept { return reverse_iterator(begin()); }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+    // capacity
+    [[nodiscard]] constexpr size_type        size() const noexcept { return _size; }
+    [[nodiscard]] constexpr size_type        length() const noexcept { return _size; }
+    [[nodiscard]] static constexpr size_type max_size() noexcept { return Capacity; }
+    [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+    [[nodiscard]] constexpr bool             empty() const noexcept { return _size == 0; }
+    [[nodiscard]] constexpr bool             full() const noexcept { return _size == Capacity; }
+
+    // element access
+    [[nodiscard]] constexpr reference       operator[](size_type n) { return _data[n]; }
+    [[nodiscard]] constexpr const_reference operator[](size_type n) const { return _data[n]; }
+    [[nodiscard]] constexpr reference       at(size_type n)
+    {
+        if (n >= size())
+            throw std::out_of_range("fixstr::basic_inplace_string::at");
+        return _data[n];
+    }
+    [[nodiscard]] constexpr const_reference at(size_type n) const
+    {
+        if (n >= size())
+            throw std::out_of_range("fixstr::basic_inplace_string::at");
+        return _data[n];
+    }
+    [[nodiscard]] constexpr reference       front() { return _data[0]; }
+    [[nodiscard]] constexpr const_reference front() const { return _data[0]; }
+    [[nodiscard]] constexpr reference       back() { return _data[size() - 1]; }
+    [[nodiscard]] constexpr const_reference back() const { return _data[size() - 1]; }
+
+    [[nodiscard]] constexpr pointer       data() noexcept { return _data.data(); }
+    [[nodiscard]] constexpr const_pointer data() const noexcept { return _data.data(); }
+    [[nodiscard]] constexpr const_pointer c_str() const noexcept { return data(); }
+
+    [[nodiscard]] constexpr operator string_view_type() const noexcept // NOLINT(google-explicit-constructor)
+    {
+        return {data(), size()};
+    }
+
+    // Throws std::length_error unless the size is exactly N
+    template <size_t N>
+    explicit constexpr operator basic_fixed_string<value_type, N, traits_type>() const
+    {
+        if (size() != N)
+            throw std::length_error("fixstr::basic_inplace_string: size mismatch");
+        basic_fixed_string<value_type, N, traits_type> result;
+        details::copy(begin(), end(), result.begin());
+        return result;
+    }
+
+    // modifiers
+    constexpr void clear() noexcept { set_size(0); }
+
+    constexpr basic_inplace_string& assign(string_view_type sv)
+    {
+        if (sv.size() > Capacity)
+            throw std::length_error("fixstr::basic_inplace_string::assign");
+        unchecked_assign(sv);
+        return *this;
+    }
+
+    constexpr basic_inplace_string& assign(size_type count, value_type ch)
+    {
+        if (count > Capacity)
+            throw std::length_error("fixstr::basic_inplace_string::assign");
+        details::fill(begin(), begin() + count, ch);
+        set_size(count);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool try_assign(string_view_type sv) noexcept
+    {
+        if (sv.size() > Capacity)
+            return false;
+        unchecked_assign(sv);
+        return true;
+    }
+
+    constexpr void push_back(value_type ch)
+    {
+        if (full())
+            throw std::length_error("fixstr::basic_inplace_string::push_back");
+        unchecked_push_back(ch);
+    }
+
+    [[nodiscard]] constexpr bool try_push_back(value_type ch) noexcept
+    {
+        if (full())
+            return false;
+        unchecked_push_back(ch);
+        return true;
+    }
+
+    constexpr void pop_back() noexcept { set_size(size() - 1); }
+
+    constexpr basic_inplace_string& append(string_view_type sv)
+    {
+        if (sv.size() > Capacity - size())
+            throw std::length_error("fixstr::basic_inplace_string::append");
+        unchecked_append(sv);
+        return *this;
+    }
+
+    constexpr basic_inplace_string& append(size_type count, value_type ch)
+    {
+        if (count > Capacity - size())
+            throw std::length_error("fixstr::basic_inplace_string::append");
+        details::fill(end(), end() + count, ch);
+        set_size(size() + count);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool try_append(string_view_type sv) noexcept
+    {
+        if (sv.size() > Capacity - size())
+            return false;
+        unchecked_append(sv);
+        return true;
+    }
+
+    constexpr basic_inplace_string& operator+=(string_view_type sv) { return append(sv); }
+    constexpr basic_inplace_string& operator+=(value_type ch)
+    {
+        push_back(ch);
+        return *this;
+    }
+
+    // `sv` may refer to this string
+    constexpr basic_inplace_string& insert(size_type pos, string_view_type sv)
+    {
+        if (pos > size())
+            throw std::out_of_range("fixstr::basic_inplace_string::insert");
+        const auto old_size = size();
+        append(sv);
+        rotate_tail(pos, old_size);
+        return *this;
+    }
+
+    constexpr basic_inplace_string& insert(size_type pos, size_type count, value_type ch)
+    {
+        if (pos > size())
+            throw std::out_of_range("fixstr::basic_inplace_string::insert");
+        const auto old_size = size();
+        append(count, ch);
+        rotate_tail(pos, old_size);
+        return *this;
+    }
+
+    constexpr basic_inplace_string& erase(size_type pos = 0, size_type count = npos)
+    {
+        if (pos > size())
+            throw std::out_of_range("fixstr::basic_inplace_string::erase");
+        const auto n = std::min(count, size() - pos);
+        details::copy(begin() + pos + n, end(), begin() + pos);
+        set_size(size() - n);
+        return *this;
+    }
+
+    constexpr void resize(size_type count, value_type ch = value_type())
+    {
+        if (count > Capacity)
+            throw std::length_error("fixstr::basic_inplace_string::resize");
+        if (count > size())
+            details::fill(end(), begin() + count, ch);
+        set_size(count);
+    }
+
+    // Lets `operation(data(), count)` write up to `count` characters in place and keeps as many as it returns,
+    // like std::basic_string::resize_and_overwrite. Throws std::length_error if `count` exceeds the capacity
+    template <typename TOperation>
+    constexpr void resize_and_overwrite(size_type count, TOperation operation)
+    {
+        if (count > Capacity)
+            throw std::length_error("fixstr::basic_inplace_string::resize_and_overwrite");
+        const auto new_size = static_cast<size_type>(std::move(operation)(_data.data(), count));
+        details::fill(begin() + new_size, begin() + std::max(count, size()), value_type());
+        _size = static_cast<details::inplace_size_type<Capacity>>(new_size);
+    }
+
+    constexpr void swap(basic_inplace_string& other) noexcept
+    {
+        const basic_inplace_string tmp = other;
+        other = *this;
+        *this = tmp;
+    }
+
+    // string operations
+    [[nodiscard]] constexpr basic_inplace_string substr(size_type pos = 0, size_type count = npos) const
+    {
+        if (pos > size())
+            throw std::out_of_range("fixstr::basic_inplace_string::substr");
+        basic_inplace_string result;
+        result.unchecked_assign(sv().substr(pos, count));
+        return result;
+    }
+
+    [[nodiscard]] constexpr size_type find(string_view_type v, size_type pos = 0) const noexcept { return sv().find(v, pos); }
+    [[nodiscard]] constexpr size_type find(value_type c, size_type pos = 0) const noexcept { return sv().find(c, pos); }
+    [[nodiscard]] constexpr size_type rfind(string_view_type v, size_type pos = npos) const noexcept { return sv().rfind(v, pos); }
+    [[nodiscard]] constexpr size_type rfind(value_type c, size_type pos = npos) const noexcept { return sv().rfind(c, pos); }
+    [[nodiscard]] constexpr size_type find_first_of(string_view_type v, size_type pos = 0) const noexcept { return sv().find_first_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_first_of(value_type c, size_type pos = 0) const noexcept { return sv().find_first_of(c, pos); }
+    [[nodiscard]] constexpr size_type find_last_of(string_view_type v, size_type pos = npos) const noexcept { return sv().find_last_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_last_of(value_type c, size_type pos = npos) const noexcept { return sv().find_last_of(c, pos); }
+    [[nodiscard]] constexpr size_type find_first_not_of(string_view_type v, size_type pos = 0) const noexcept { return sv().find_first_not_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_first_not_of(value_type c, size_type pos = 0) const noexcept { return sv().find_first_not_of(c, pos); }
+    [[nodiscard]] constexpr size_type find_last_not_of(string_view_type v, size_type pos = npos) const noexcept { return sv().find_last_not_of(v, pos); }
+    [[nodiscard]] constexpr size_type find_last_not_of(value_type c, size_type pos = npos) const noexcept { return sv().find_last_not_of(c, pos); }
+
+    [[nodiscard]] constexpr int compare(string_view_type v) const noexcept { return sv().compare(v); }
+
+    [[nodiscard]] constexpr bool starts_with(string_view_type v) const noexcept { return sv().substr(0, v.size()) == v; }
+    [[nodiscard]] constexpr bool starts_with(value_type c) const noexcept { return !empty() && traits_type::eq(front(), c); }
+    [[nodiscard]] constexpr bool ends_with(string_view_type v) const noexcept { return size() >= v.size() && sv().substr(size() - v.size()) == v; }
+    [[nodiscard]] constexpr bool ends_with(value_type c) const noexcept { return !empty() && traits_type::eq(back(), c); }
+    [[nodiscard]] constexpr bool contains(string_view_type v) const noexcept { return find(v) != npos; }
+    [[nodiscard]] constexpr bool contains(value_type c) const noexcept { return find(c) != npos; }
+
+  private:
+    constexpr string_view_type sv() const noexcept { return *this; }
+
+    constexpr void set_size(size_type new_size) noexcept
+    {
+        if (new_size < size())
+            details::fill(begin() + new_size, end(), value_type());
+        _data[new_size] = value_type();
+        _size = static_cast<details::inplace_size_type<Capacity>>(new_size);
+    }
+
+    // `sv` may only overlap with this string at a position not before the destination
+    constexpr void unchecked_assign(string_view_type sv) noexcept
+    {
+        details::copy(sv.begin(), sv.end(), begin());
+        set_size(sv.size());
+    }
+
+    constexpr void unchecked_append(string_view_type sv) noexcept
+    {
+        details::copy(sv.begin(), sv.end(), end());
+        set_size(size() + sv.size());
+    }
+
+    constexpr void unchecked_push_back(value_type ch) noexcept
+    {
+        _data[size()] = ch;
+        set_size(size() + 1);
+    }
+
+    // Moves the characters in [middle, size()) to `pos`, shifting [pos, middle) to the right
+    constexpr void rotate_tail(size_type pos, size_type middle) noexcept
+    {
+        details::reverse(begin() + pos, begin() + middle);
+        details::reverse(begin() + middle, end());
+        details::reverse(begin() + pos, end());
+    }
+};
+
+template <typename TChar, size_t Capacity, typename TTraits>
+constexpr void swap(basic_inplace_string<TChar, Capacity, TTraits>& lhs, basic_inplace_string<TChar, Capacity, TTraits>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+namespace details
+{
+template <typename T>
+struct is_inplace_string : std::false_type
+{
+};
+
+template <typename TChar, size_t Capacity, typename TTraits>
+struct is_inplace_string<basic_inplace_string<TChar, Capacity, TTraits>> : std::true_type
+{
+};
+
+// Inplace strings compare with each other and with everything convertible to their string view type,
+// fixed strings and string literals included
+template <typename TInplace, typename TOther>
+constexpr bool is_inplace_comparable_v =
+    is_inplace_string<TOther>::value || std::is_convertible_v<const TOther&, typename TInplace::string_view_type>;
+
+template <typename TInplace, typename TOther>
+constexpr typename TInplace::string_view_type as_view(const TOther& other) noexcept
+{
+    return typename TInplace::string_view_type(other);
+}
+} // namespace details
+
+#if FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator==(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) == details::as_view<inplace_type>(rhs);
+}
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr auto operator<=>(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) <=> details::as_view<inplace_type>(rhs);
+}
+
+#else
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator==(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) == details::as_view<inplace_type>(rhs);
+}
+
+template <typename TOther, typename TChar, size_t Capacity, typename TTraits,
+          typename = std::enable_if_t<!details::is_inplace_string<TOther>::value &&
+                                      details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator==(const TOther& lhs, const basic_inplace_string<TChar, Capacity, TTraits>& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return details::as_view<inplace_type>(lhs) == static_cast<typename inplace_type::string_view_type>(rhs);
+}
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator!=(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) != details::as_view<inplace_type>(rhs);
+}
+
+template <typename TOther, typename TChar, size_t Capacity, typename TTraits,
+          typename = std::enable_if_t<!details::is_inplace_string<TOther>::value &&
+                                      details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator!=(const TOther& lhs, const basic_inplace_string<TChar, Capacity, TTraits>& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return details::as_view<inplace_type>(lhs) != static_cast<typename inplace_type::string_view_type>(rhs);
+}
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) < details::as_view<inplace_type>(rhs);
+}
+
+template <typename TOther, typename TChar, size_t Capacity, typename TTraits,
+          typename = std::enable_if_t<!details::is_inplace_string<TOther>::value &&
+                                      details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<(const TOther& lhs, const basic_inplace_string<TChar, Capacity, TTraits>& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return details::as_view<inplace_type>(lhs) < static_cast<typename inplace_type::string_view_type>(rhs);
+}
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<=(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) <= details::as_view<inplace_type>(rhs);
+}
+
+template <typename TOther, typename TChar, size_t Capacity, typename TTraits,
+          typename = std::enable_if_t<!details::is_inplace_string<TOther>::value &&
+                                      details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator<=(const TOther& lhs, const basic_inplace_string<TChar, Capacity, TTraits>& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return details::as_view<inplace_type>(lhs) <= static_cast<typename inplace_type::string_view_type>(rhs);
+}
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) > details::as_view<inplace_type>(rhs);
+}
+
+template <typename TOther, typename TChar, size_t Capacity, typename TTraits,
+          typename = std::enable_if_t<!details::is_inplace_string<TOther>::value &&
+                                      details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>(const TOther& lhs, const basic_inplace_string<TChar, Capacity, TTraits>& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return details::as_view<inplace_type>(lhs) > static_cast<typename inplace_type::string_view_type>(rhs);
+}
+
+template <typename TChar, size_t Capacity, typename TTraits, typename TOther,
+          typename = std::enable_if_t<details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>=(const basic_inplace_string<TChar, Capacity, TTraits>& lhs, const TOther& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return static_cast<typename inplace_type::string_view_type>(lhs) >= details::as_view<inplace_type>(rhs);
+}
+
+template <typename TOther, typename TChar, size_t Capacity, typename TTraits,
+          typename = std::enable_if_t<!details::is_inplace_string<TOther>::value &&
+                                      details::is_inplace_comparable_v<basic_inplace_string<TChar, Capacity, TTraits>, TOther>>>
+[[nodiscard]] constexpr bool operator>=(const TOther& lhs, const basic_inplace_string<TChar, Capacity, TTraits>& rhs) noexcept
+{
+    using inplace_type = basic_inplace_string<TChar, Capacity, TTraits>;
+    return details::as_view<inplace_type>(lhs) >= static_cast<typename inplace_type::string_view_type>(rhs);
+}
+
+#endif // FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+
+template <typename TChar, size_t C1, size_t C2, typename TTraits>
+[[nodiscard]] constexpr basic_inplace_string<TChar, C1 + C2, TTraits> operator+(const basic_inplace_string<TChar, C1, TTraits>& lhs,
+                                                                                const basic_inplace_string<TChar, C2, TTraits>& rhs) noexcept
+{
+    basic_inplace_string<TChar, C1 + C2, TTraits> result = lhs;
+    (void)result.try_append(rhs);
+    return result;
+}
+
+template <typename TChar, size_t C, size_t N, typename TTraits>
+[[nodiscard]] constexpr basic_inplace_string<TChar, C + N, TTraits> operator+(const basic_inplace_string<TChar, C, TTraits>& lhs,
+                                                                              const basic_fixed_string<TChar, N, TTraits>&   rhs) noexcept
+{
+    basic_inplace_string<TChar, C + N, TTraits> result = lhs;
+    (void)result.try_append(rhs);
+    return result;
+}
+
+template <typename TChar, size_t N, size_t C, typename TTraits>
+[[nodiscard]] constexpr basic_inplace_string<TChar, N + C, TTraits> operator+(const basic_fixed_string<TChar, N, TTraits>&   lhs,
+                                                                              const basic_inplace_string<TChar, C, TTraits>& rhs) noexcept
+{
+    basic_inplace_string<TChar, N + C, TTraits> result = lhs;
+    (void)result.try_append(rhs);
+    return result;
+}
+
+template <typename TChar, size_t C, size_t N, typename TTraits>
+[[nodiscard]] constexpr basic_inplace_string<TChar, C + N - 1, TTraits> operator+(const basic_inplace_string<TChar, C, TTraits>& lhs,
+                                                                                  const TChar (&rhs)[N]) noexcept
+{
+    basic_inplace_string<TChar, C + N - 1, TTraits> result = lhs;
+    (void)result.try_append(std::basic_string_view<TChar, TTraits>(rhs, N - 1));
+    return result;
+}
+
+template <typename TChar, size_t N, size_t C, typename TTraits>
+[[nodiscard]] constexpr basic_inplace_string<TChar, N - 1 + C, TTraits> operator+(const TChar (&lhs)[N],
+                                                                                  const basic_inplace_string<TChar, C, TTraits>& rhs) noexcept
+{
+    basic_inplace_string<TChar, N - 1 + C, TTraits> result = lhs;
+    (void)result.try_append(rhs);
+    return result;
+}
+
+template <typename TChar, size_t C, typename TTraits>
+[[nodiscard]] constexpr basic_inplace_string<TChar, C + 1, TTraits> operator+(const basic_inplace_string<TChar, C, TTraits>& lhs, TChar rhs) noexcept
+{
+    basic_inplace_string<TChar, C + 1, TTraits> result = lhs;
+    (void)result.try_push_back(rhs);
+    return result;
+}
+
+template <typename TChar, size_t C, typename TTraits>
+[[nodiscard]] constexpr basic_inplace_string<TChar, C + 1, TTraits> operator+(TChar lhs, const basic_inplace_string<TChar, C, TTraits>& rhs) noexcept
+{
+    basic_inplace_string<TChar, C + 1, TTraits> result;
+    (void)result.try_push_back(lhs);
+    (void)result.try_append(rhs);
+    return result;
+}
+
+template <typename TChar, size_t Capacity, typename TTraits>
+std::basic_ostream<TChar, TTraits>& operator<<(std::basic_ostream<TChar, TTraits>& out, const basic_inplace_string<TChar, Capacity, TTraits>& str)
+{
+    return out << static_cast<std::basic_string_view<TChar, TTraits>>(str);
+}
+
+template <size_t Capacity>
+using inplace_string = basic_inplace_string<char, Capacity>;
+#if FIXSTR_CPP20_CHAR8T_PRESENT
+template <size_t Capacity>
+using inplace_u8string = basic_inplace_string<char8_t, Capacity>;
+#endif // FIXSTR_CPP20_CHAR8T_PRESENT
+template <size_t Capacity>
+using inplace_u16string = basic_inplace_string<char16_t, Capacity>;
+template <size_t Capacity>
+using inplace_u32string = basic_inplace_string<char32_t, Capacity>;
+template <size_t Capacity>
+using inplace_wstring = basic_inplace_string<wchar_t, Capacity>;
+
+} // namespace fixstr
+
+// hash support
+namespace std
+{
+template <typename TChar, size_t Capacity, typename TTraits>
+struct hash<fixstr::basic_inplace_string<TChar, Capacity, TTraits>>
+{
+    using argument_type = fixstr::basic_inplace_string<TChar, Capacity, TTraits>;
+    constexpr size_t operator()(const argument_type& str) const noexcept
+    {
+        return fixstr::hash{}(static_cast<typename argument_type::string_view_type>(str));
+    }
+};
+} // namespace std
+
+#endif // FIXSTR_INPLACE_STRING_HPP
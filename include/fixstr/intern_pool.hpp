@@ -0,0 +1,225 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_INTERN_POOL_HPP
+#define FIXSTR_INTERN_POOL_HPP
+
+#include "../fixed_string.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+namespace fixstr
+{
+
+namespace details::intern
+{
+// A bucket holds the upper half of the string hash as a tag and the id plus one in the lower half.
+// Zero is an empty bucket, the two largest values of the lower half mark buckets without a published id.
+constexpr std::uint64_t tag_mask = 0xFFFFFFFF00000000ULL;
+constexpr std::uint64_t id_mask = 0x00000000FFFFFFFFULL;
+constexpr std::uint64_t pending = 0xFFFFFFFFULL;   // claimed by a thread that is writing the string
+constexpr std::uint64_t abandoned = 0xFFFFFFFEULL; // claimed when the pool was full, never gets an id
+
+template <size_t N>
+using length_t = std::conditional_t<(N <= 0xFF), std::uint8_t, std::conditional_t<(N <= 0xFFFF), std::uint16_t, std::uint32_t>>;
+
+// Strings are zero-padded to the slot width and compared with the fixed-size kernels
+template <size_t N>
+struct slot
+{
+    char        data[N];
+    length_t<N> length;
+};
+} // namespace details::intern
+
+// A concurrent pool of strings of up to N characters that hands out dense ids 0, 1, 2, ... in interning order.
+// Lookups never lock: buckets are claimed with a compare-and-swap and never change once an id is published in them.
+// find() never waits, intern() only waits for a thread that is interning a string with the same hash tag at that moment,
+// so that both get the same id.
+// Strings are stored once in an arena of fixed-width slots indexed by id, so ids resolve back to strings in O(1).
+// The capacity is fixed when the pool is created.
+template <size_t N>
+class intern_pool
+{
+    static_assert(N > 0, "strings of an intern_pool have at least one character");
+
+    using slot_type = details::intern::slot<N>;
+
+  public:
+    using id_type = std::uint32_t;
+
+    static constexpr id_type npos = static_cast<id_type>(-1);
+    static constexpr size_t  max_capacity = 0x7FFFFFFF;
+
+    // Throws std::length_error if `capacity` exceeds max_capacity. Nothing is written to the arena until strings are interned.
+    explicit intern_pool(size_t capacity)
+        : _capacity(check_capacity(capacity)),
+          _mask(bucket_count(capacity) - 1),
+          _buckets(new std::atomic<std::uint64_t>[_mask + 1]()),
+          _slots(new slot_type[capacity])
+    {
+    }
+
+    intern_pool(const intern_pool&) = delete;
+    intern_pool& operator=(const intern_pool&) = delete;
+
+    [[nodiscard]] size_t capacity() const noexcept { return _capacity; }
+
+    // Ids handed out so far, including the ones whose strings other threads are writing right now
+    [[nodiscard]] size_t size() const noexcept
+    {
+        const auto next = _next.load(std::memory_order_relaxed);
+        return next < _capacity ? static_cast<size_t>(next) : _capacity;
+    }
+
+    // The id of the string, which is interned first if it is new.
+    // Throws std::length_error for strings longer than N characters and when the pool is full.
+    id_type intern(std::string_view str)
+    {
+        if (str.size() > N)
+            throw std::length_error("fixstr::intern_pool: the string is longer than the slots");
+        char key[N] = {};
+        details::copy(str.begin(), str.end(), key);
+        const auto hashed = static_cast<std::uint64_t>(hash{}(str));
+        const auto tag = hashed & details::intern::tag_mask;
+        for (size_t probes = 0, index = hashed & _mask; probes <= _mask; ++probes, index = (index + 1) & _mask)
+        {
+            auto&         bucket = _buckets[index];
+            std::uint64_t value = bucket.load(std::memory_order_acquire);
+            if (value == 0 && bucket.compare_exchange_strong(value, tag | details::intern::pending, std::memory_order_acquire))
+                return publish(bucket, tag, key, str.size());
+            if (const id_type id = match(bucket, value, tag, key, str.size()); id != npos)
+                return id;
+        }
+        throw std::length_error("fixstr::intern_pool: the pool is full");
+    }
+
+    // The id of the string or npos if it was not interned, lock-free: buckets that are being published are skipped, never waited for
+    [[nodiscard]] id_type find(std::string_view str) const noexcept
+    {
+        if (str.size() > N)
+            return npos;
+        char key[N] = {};
+        details::copy(str.begin(), str.end(), key);
+        const auto hashed = static_cast<std::uint64_t>(hash{}(str));
+        const auto tag = hashed & details::intern::tag_mask;
+        for (size_t probes = 0, index = hashed & _mask; probes <= _mask; ++probes, index = (index + 1) & _mask)
+        {
+            const auto&         bucket = _buckets[index];
+            const std::uint64_t value = bucket.load(std::memory_order_acquire);
+            if (value == 0)
+                return npos;
+            // a string that another thread is still writing is not interned yet
+            if ((value & details::intern::id_mask) == details::intern::pending)
+                continue;
+            if (const id_type id = match(bucket, value, tag, key, str.size()); id != npos)
+                return id;
+        }
+        return npos;
+    }
+
+    [[nodiscard]] bool contains(std::string_view str) const noexcept { return find(str) != npos; }
+
+    // The string of an id returned by intern or find
+    [[nodiscard]] std::string_view operator[](id_type id) const noexcept
+    {
+        const slot_type& slot = _slots[id];
+        return std::string_view(slot.data, slot.length);
+    }
+
+    [[nodiscard]] std::string_view at(id_type id) const
+    {
+        if (id >= size())
+            throw std::out_of_range("fixstr::intern_pool: the id is out of range");
+        return (*this)[id];
+    }
+
+  private:
+    static size_t check_capacity(size_t capacity)
+    {
+        if (capacity > max_capacity)
+            throw std::length_error("fixstr::intern_pool: the capacity is too large");
+        return capacity;
+    }
+
+    // At most half of the buckets are used, so probe sequences stay short
+    static constexpr size_t bucket_count(size_t capacity) noexcept
+    {
+        size_t result = 16;
+        while (result < capacity * 2)
+            result *= 2;
+        return result;
+    }
+
+    // Called by the thread that claimed the bucket: takes the next id, writes the string to its slot and publishes the id
+    id_type publish(std::atomic<std::uint64_t>& bucket, std::uint64_t tag, const char* key, size_t size)
+    {
+        const auto next = _next.fetch_add(1, std::memory_order_relaxed);
+        if (next >= _capacity)
+        {
+            bucket.store(tag | details::intern::abandoned, std::memory_order_release);
+            throw std::length_error("fixstr::intern_pool: the pool is full");
+        }
+        slot_type& slot = _slots[next];
+        std::memcpy(slot.data, key, N);
+        slot.length = static_cast<details::intern::length_t<N>>(size);
+        bucket.store(tag | (next + 1), std::memory_order_release);
+        return static_cast<id_type>(next);
+    }
+
+    // The id in a non-empty bucket if it holds the string, npos otherwise. Waits while the bucket is being published.
+    id_type match(const std::atomic<std::uint64_t>& bucket, std::uint64_t value, std::uint64_t tag, const char* key, size_t size) const noexcept
+    {
+        if ((value & details::intern::tag_mask) != tag)
+            return npos;
+        while ((value & details::intern::id_mask) == details::intern::pending)
+        {
+            std::this_thread::yield();
+            value = bucket.load(std::memory_order_acquire);
+        }
+        if ((value & details::intern::id_mask) == details::intern::abandoned)
+            return npos;
+        const auto       id = static_cast<id_type>((value & details::intern::id_mask) - 1);
+        const slot_type& slot = _slots[id];
+        return slot.length == size && details::fixed_equal<char, std::char_traits<char>, N>(slot.data, key) ? id : npos;
+    }
+
+    size_t                                        _capacity;
+    size_t                                        _mask;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> _buckets;
+    std::unique_ptr<slot_type[]>                  _slots;
+    alignas(64) std::atomic<std::uint64_t> _next{0};
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_INTERN_POOL_HPP
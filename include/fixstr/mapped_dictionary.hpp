@@ -0,0 +1,375 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_MAPPED_DICTIONARY_HPP
+#define FIXSTR_MAPPED_DICTIONARY_HPP
+
+#include "../fixed_string.hpp"
+#include "sort.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FIXSTR_MMAP_PRESENT 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define FIXSTR_MMAP_PRESENT 0
+#endif // FIXSTR_MMAP_PRESENT
+
+namespace fixstr
+{
+
+// The index written after the sorted keys of a dictionary file
+enum class dictionary_index : std::uint64_t
+{
+    none = 0, // lookups use binary search
+    hash = 1, // open addressing over 32-bit key numbers, hashed with fixstr::hash
+};
+
+namespace details::dictionary
+{
+// Version 2 of the file format, all integers in the byte order of the writer:
+//   header     64 bytes, see below
+//   keys       `count` sorted unique keys of `key_size` bytes without terminators, at `keys_offset`
+//   index      `index_slots` 32-bit slots at `index_offset`, a slot holds the key number plus one or 0 if it is free
+// The slots of a key depend on its hash, so the header names the hash function the index was built with.
+// Sections start at multiples of 64 bytes, so the keys and the index of a mapped file are cache-line aligned.
+struct header
+{
+    char          magic[8];
+    std::uint32_t byte_order;
+    std::uint32_t version;
+    std::uint64_t key_size;
+    std::uint64_t count;
+    std::uint64_t keys_offset;
+    std::uint32_t index_kind;
+    std::uint32_t index_hash;
+    std::uint64_t index_offset;
+    std::uint64_t index_slots;
+};
+static_assert(sizeof(header) == 64);
+
+constexpr char          magic[8] = {'F', 'I', 'X', 'S', 'T', 'R', 'D', 'C'};
+constexpr std::uint32_t byte_order = 0x01020304;
+constexpr std::uint32_t version = 2;
+constexpr size_t        alignment = 64;
+
+// The id of the hash function of the index, a new id is assigned whenever the output of fixstr::hash changes
+constexpr std::uint32_t wyhash_final4 = 1;
+constexpr std::uint32_t current_hash = wyhash_final4;
+
+constexpr std::uint64_t align(std::uint64_t offset) noexcept
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+[[noreturn]] inline void throw_corrupted(const char* what)
+{
+    throw std::runtime_error(std::string("fixstr::mapped_dictionary: ") + what);
+}
+} // namespace details::dictionary
+
+// A read-only dictionary of fixed_string<N> stored in the file format of mapped_dictionary::write.
+// Opening a file maps it and validates the header, nothing is read or deserialized, so it takes the same time for any size;
+// pages are loaded by the first lookups that touch them. Elements are fixed_string_view<N> into the mapping.
+template <size_t N>
+class mapped_dictionary
+{
+  public:
+    static constexpr size_t npos = size_t(-1);
+
+    // Writes fixed strings of N characters sorted and without duplicates, throws std::runtime_error if the stream fails
+    template <typename InputIterator>
+    static void write(std::ostream& out, InputIterator first, InputIterator last, dictionary_index index = dictionary_index::hash)
+    {
+        std::vector<fixed_string<N>> keys;
+        for (; first != last; ++first)
+            keys.emplace_back(*first);
+        keys.erase(fixstr::sort_unique(keys.begin(), keys.end(), 0), keys.end());
+
+        namespace format = details::dictionary;
+        format::header header{};
+        std::memcpy(header.magic, format::magic, sizeof(header.magic));
+        header.byte_order = format::byte_order;
+        header.version = format::version;
+        header.key_size = N;
+        header.count = keys.size();
+        header.keys_offset = format::align(sizeof(header));
+        header.index_kind = static_cast<std::uint32_t>(index);
+
+        std::vector<std::uint32_t> slots;
+        if (index == dictionary_index::hash)
+        {
+            if (keys.size() >= std::uint32_t(-1))
+                throw std::length_error("fixstr::mapped_dictionary: too many keys for the hash index");
+            // at most half of the slots are used
+            size_t capacity = 16;
+            while (capacity < keys.size() * 2)
+                capacity *= 2;
+            slots.resize(capacity);
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                size_t slot = hash{}(keys[i]) & (capacity - 1);
+                while (slots[slot] != 0)
+                    slot = (slot + 1) & (capacity - 1);
+                slots[slot] = static_cast<std::uint32_t>(i + 1);
+            }
+            header.index_hash = format::current_hash;
+            header.index_offset = format::align(header.keys_offset + keys.size() * N);
+            header.index_slots = capacity;
+        }
+
+        const char padding[format::alignment] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(padding, static_cast<std::streamsize>(header.keys_offset - sizeof(header)));
+        for (const auto& key : keys)
+            out.write(key.data(), N);
+        if (!slots.empty())
+        {
+            out.write(padding, static_cast<std::streamsize>(header.index_offset - header.keys_offset - keys.size() * N));
+            out.write(reinterpret_cast<const char*>(slots.data()), static_cast<std::streamsize>(slots.size() * sizeof(std::uint32_t)));
+        }
+        if (!out)
+            throw std::runtime_error("fixstr::mapped_dictionary: unable to write the dictionary");
+    }
+
+    mapped_dictionary() = default;
+
+    // A dictionary in a buffer that outlives it, for example a file mapped by the caller.
+    // Throws std::runtime_error if the buffer does not hold a dictionary of N-character keys.
+    mapped_dictionary(const void* data, size_t size) { attach(static_cast<const char*>(data), size); }
+
+#if FIXSTR_MMAP_PRESENT
+    // Maps the file read-only, throws std::system_error if it cannot be mapped
+    explicit mapped_dictionary(const std::string& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "fixstr::mapped_dictionary: unable to open " + path);
+        struct stat status;
+        if (::fstat(fd, &status) != 0)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fixstr::mapped_dictionary: unable to stat " + path);
+        }
+        const auto size = static_cast<size_t>(status.st_size);
+        void*      mapping = size == 0 ? MAP_FAILED : ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        const int  error = errno;
+        ::close(fd);
+        if (size == 0)
+            details::dictionary::throw_corrupted("the file is empty");
+        if (mapping == MAP_FAILED)
+            throw std::system_error(error, std::generic_category(), "fixstr::mapped_dictionary: unable to map " + path);
+        _mapping = mapping;
+        _mapping_size = size;
+        try
+        {
+            attach(static_cast<const char*>(mapping), size);
+        }
+        catch (...)
+        {
+            unmap();
+            throw;
+        }
+    }
+#endif // FIXSTR_MMAP_PRESENT
+
+    mapped_dictionary(const mapped_dictionary&) = delete;
+    mapped_dictionary& operator=(const mapped_dictionary&) = delete;
+
+    mapped_dictionary(mapped_dictionary&& other) noexcept { swap(other); }
+
+    mapped_dictionary& operator=(mapped_dictionary&& other) noexcept
+    {
+        mapped_dictionary(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~mapped_dictionary() { unmap(); }
+
+    void swap(mapped_dictionary& other) noexcept
+    {
+        std::swap(_keys, other._keys);
+        std::swap(_size, other._size);
+        std::swap(_slots, other._slots);
+        std::swap(_slot_count, other._slot_count);
+        std::swap(_mapping, other._mapping);
+        std::swap(_mapping_size, other._mapping_size);
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return _size; }
+    [[nodiscard]] bool   empty() const noexcept { return _size == 0; }
+    [[nodiscard]] bool   has_hash_index() const noexcept { return _slots != nullptr; }
+
+    [[nodiscard]] fixed_string_view<N> operator[](size_t index) const noexcept { return fixed_string_view<N>(_keys + index * N); }
+
+    [[nodiscard]] fixed_string_view<N> at(size_t index) const
+    {
+        if (index >= _size)
+            throw std::out_of_range("fixstr::mapped_dictionary::at: index is out of range");
+        return (*this)[index];
+    }
+
+    // The number of the key, or npos. Uses the hash index if the file has one and binary search otherwise.
+    [[nodiscard]] size_t find(std::string_view key) const noexcept
+    {
+        if (key.size() != N)
+            return npos;
+        if (_slots == nullptr)
+            return find_sorted(key.data());
+        // the probe count and the entries are bounded so that a damaged index cannot loop or read outside the keys
+        const size_t mask = _slot_count - 1;
+        size_t       slot = hash{}(fixed_string_view<N>(key.data())) & mask;
+        for (size_t probes = 0; probes < _slot_count; ++probes, slot = (slot + 1) & mask)
+        {
+            std::uint32_t entry;
+            std::memcpy(&entry, _slots + slot * sizeof(entry), sizeof(entry));
+            if (entry == 0 || entry > _size)
+                return npos;
+            if (details::fixed_equal<char, std::char_traits<char>, N>(_keys + (entry - 1) * N, key.data()))
+                return entry - 1;
+        }
+        return npos;
+    }
+
+    [[nodiscard]] bool contains(std::string_view key) const noexcept { return find(key) != npos; }
+
+    // Binary search for the key, whatever the index of the file is
+    [[nodiscard]] size_t find_sorted(std::string_view key) const noexcept
+    {
+        if (key.size() != N)
+            return npos;
+        const size_t index = lower_bound(key);
+        return index != _size && details::fixed_equal<char, std::char_traits<char>, N>(_keys + index * N, key.data()) ? index : npos;
+    }
+
+    // The number of the first key that is not less than `key`, compared as strings
+    [[nodiscard]] size_t lower_bound(std::string_view key) const noexcept
+    {
+        if (key.size() == N)
+            return partition_point([&](const char* element) { return details::fixed_compare<char, std::char_traits<char>, N>(element, key.data()) < 0; });
+        return partition_point([&](const char* element) { return std::string_view(element, N) < key; });
+    }
+
+    // The numbers [first, last) of the keys that start with `prefix`
+    [[nodiscard]] std::pair<size_t, size_t> prefix_range(std::string_view prefix) const noexcept
+    {
+        if (prefix.size() > N)
+            return {_size, _size};
+        const auto head = [&](const char* element) { return std::char_traits<char>::compare(element, prefix.data(), prefix.size()); };
+        return {partition_point([&](const char* element) { return head(element) < 0; }),
+                partition_point([&](const char* element) { return head(element) <= 0; })};
+    }
+
+  private:
+    // The first key for which `before` is false, the keys for which it is true come first
+    template <typename TPredicate>
+    size_t partition_point(TPredicate before) const noexcept
+    {
+        size_t first = 0;
+        size_t count = _size;
+        while (count > 0)
+        {
+            const size_t half = count / 2;
+            if (before(_keys + (first + half) * N))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+        return first;
+    }
+
+    void attach(const char* data, size_t size)
+    {
+        namespace format = details::dictionary;
+        format::header header;
+        if (size < sizeof(header))
+            format::throw_corrupted("the header is truncated");
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, format::magic, sizeof(header.magic)) != 0)
+            format::throw_corrupted("not a dictionary file");
+        if (header.byte_order != format::byte_order)
+            format::throw_corrupted("the file was written with another byte order");
+        if (header.version != format::version)
+            format::throw_corrupted("unsupported version");
+        if (header.key_size != N)
+            format::throw_corrupted("the key size differs");
+        if (header.keys_offset < sizeof(header) || header.keys_offset > size || header.count > (size - header.keys_offset) / N)
+            format::throw_corrupted("the keys are truncated");
+
+        _keys = data + header.keys_offset;
+        _size = static_cast<size_t>(header.count);
+        _slots = nullptr;
+        _slot_count = 0;
+        if (header.index_kind == static_cast<std::uint32_t>(dictionary_index::hash))
+        {
+            if (header.index_hash != format::current_hash)
+                format::throw_corrupted("the hash index was built with an unknown hash function");
+            const auto slots = header.index_slots;
+            if (slots == 0 || (slots & (slots - 1)) != 0 || slots < header.count * 2 || header.index_offset > size ||
+                slots > (size - header.index_offset) / sizeof(std::uint32_t))
+                format::throw_corrupted("the hash index is invalid");
+            _slots = data + header.index_offset;
+            _slot_count = static_cast<size_t>(slots);
+        }
+        else if (header.index_kind != static_cast<std::uint32_t>(dictionary_index::none))
+            format::throw_corrupted("unknown index");
+    }
+
+    void unmap() noexcept
+    {
+#if FIXSTR_MMAP_PRESENT
+        if (_mapping != nullptr)
+            ::munmap(_mapping, _mapping_size);
+#endif // FIXSTR_MMAP_PRESENT
+        _mapping = nullptr;
+    }
+
+    const char* _keys = nullptr;
+    size_t      _size = 0;
+    const char* _slots = nullptr;
+    size_t      _slot_count = 0;
+    void*       _mapping = nullptr;
+    size_t      _mapping_size = 0;
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_MAPPED_DICTIONARY_HPP
@@ -0,0 +1,286 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_MULTI_SEARCH_HPP
+#define FIXSTR_MULTI_SEARCH_HPP
+
+#include "../fixed_string.hpp"
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace fixstr
+{
+
+struct multi_match
+{
+    size_t pattern;  // index of the pattern in the template argument list, npos if nothing was found
+    size_t position; // position of the first character of the occurrence
+
+    static constexpr size_t npos = size_t(-1);
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return pattern != npos; }
+    [[nodiscard]] friend constexpr bool operator==(const multi_match&, const multi_match&) noexcept = default;
+};
+
+namespace details::aho_corasick
+{
+inline constexpr std::uint32_t none = std::uint32_t(-1);
+
+template <typename T, typename...>
+struct first
+{
+    using type = T;
+};
+
+// Characters are translated to dense classes before the transition lookup: class 0 collects every character
+// that occurs in no pattern, so each state row is only as wide as the patterns' alphabet.
+template <size_t Patterns, typename TStringView>
+constexpr auto make_classes(const std::array<TStringView, Patterns>& patterns)
+{
+    std::array<std::uint16_t, 256> classes{};
+    std::uint16_t                  count = 1;
+    for (const auto pattern : patterns)
+        for (const auto ch : pattern)
+        {
+            auto& cls = classes[static_cast<unsigned char>(ch)];
+            if (cls == 0)
+                cls = count++;
+        }
+    return std::pair{classes, size_t(count)};
+}
+
+// Builds the trie of the patterns. Child ids are stored per (state, class), 0 means "no child" since the root is nobody's child.
+template <size_t States, size_t Classes, size_t Patterns, typename TStringView>
+constexpr size_t make_trie(const std::array<TStringView, Patterns>& patterns,
+                           const std::array<std::uint16_t, 256>&    classes,
+                           std::array<std::uint32_t, States * Classes>& children,
+                           std::array<std::uint32_t, States>&        output)
+{
+    for (auto& pattern_index : output)
+        pattern_index = none;
+    size_t count = 1;
+    for (size_t p = 0; p < Patterns; ++p)
+    {
+        if (patterns[p].empty())
+            throw std::logic_error("fixstr::multi_searcher: empty pattern");
+        size_t state = 0;
+        for (const auto ch : patterns[p])
+        {
+            auto& child = children[state * Classes + classes[static_cast<unsigned char>(ch)]];
+            if (child == 0)
+                child = static_cast<std::uint32_t>(count++);
+            state = child;
+        }
+        if (output[state] != none)
+            throw std::logic_error("fixstr::multi_searcher: duplicate patterns");
+        output[state] = static_cast<std::uint32_t>(p);
+    }
+    return count;
+}
+
+template <size_t States, size_t Classes, typename TState>
+struct automaton
+{
+    // `transitions[row + class]` is the row of the next state, i.e. its id times Classes, so the hot loop is a single
+    // dependent load and add per character. States where a pattern ends are numbered last: reaching one of them is
+    // detected by comparing the row with `first_accepting_row`.
+    std::array<TState, States * Classes> transitions{};
+    std::array<std::uint32_t, States>    output{};      // pattern ending exactly in a state or `none`
+    std::array<std::uint32_t, States>    next_output{}; // closest proper suffix state where a pattern ends, 0 if none
+    size_t                               first_accepting_row = 0;
+};
+
+template <size_t States, size_t Classes, typename TState, size_t Patterns, typename TStringView>
+constexpr automaton<States, Classes, TState> make_automaton(const std::array<TStringView, Patterns>& patterns,
+                                                           const std::array<std::uint16_t, 256>&    classes)
+{
+    std::array<std::uint32_t, States * Classes> next{};
+    std::array<std::uint32_t, States>           output{};
+    make_trie<States, Classes>(patterns, classes, next, output);
+
+    // Breadth-first order guarantees that the failure state of every node already has its complete row
+    std::array<std::uint32_t, States> fail{};
+    std::array<std::uint32_t, States> next_output{};
+    std::array<std::uint32_t, States> queue{};
+    size_t                            head = 0;
+    size_t                            tail = 0;
+    for (size_t c = 0; c < Classes; ++c)
+        if (next[c] != 0)
+            queue[tail++] = next[c];
+    while (head < tail)
+    {
+        const auto state = queue[head++];
+        const auto suffix = fail[state];
+        next_output[state] = output[suffix] != none ? suffix : next_output[suffix];
+        for (size_t c = 0; c < Classes; ++c)
+        {
+            auto& child = next[state * Classes + c];
+            if (child != 0)
+            {
+                fail[child] = next[suffix * Classes + c];
+                queue[tail++] = child;
+            }
+            else
+                child = next[suffix * Classes + c];
+        }
+    }
+
+    // Renumber the states, keeping the root first and moving accepting states to the end
+    automaton<States, Classes, TState> result;
+    std::array<std::uint32_t, States>  renumbered{};
+    std::uint32_t                      id = 0;
+    for (const bool accepting : {false, true})
+    {
+        if (accepting)
+            result.first_accepting_row = id * Classes;
+        for (size_t state = 0; state < States; ++state)
+            if ((output[state] != none || next_output[state] != 0) == accepting)
+                renumbered[state] = id++;
+    }
+
+    for (size_t state = 0; state < States; ++state)
+    {
+        const auto to = renumbered[state];
+        result.output[to] = output[state];
+        result.next_output[to] = renumbered[next_output[state]];
+        for (size_t c = 0; c < Classes; ++c)
+            result.transitions[to * Classes + c] = static_cast<TState>(renumbered[next[state * Classes + c]] * Classes);
+    }
+    return result;
+}
+} // namespace details::aho_corasick
+
+// Finds every occurrence of any of the patterns in a single pass over the haystack.
+// The Aho-Corasick automaton is built during compilation as a dense transition table over the patterns' alphabet,
+// so each haystack character costs one class lookup and one transition load.
+template <basic_fixed_string... Patterns>
+struct multi_searcher
+{
+    static_assert(sizeof...(Patterns) > 0, "multi_searcher requires at least one pattern");
+
+    using string_view_type = typename details::aho_corasick::first<typename decltype(Patterns)::string_view_type...>::type;
+    static_assert((std::is_same_v<string_view_type, typename decltype(Patterns)::string_view_type> && ...),
+                  "all patterns of multi_searcher must have the same character type and traits");
+
+    using value_type = typename string_view_type::value_type;
+    using traits_type = typename string_view_type::traits_type;
+    using size_type = size_t;
+    static constexpr size_type npos = multi_match::npos;
+
+    static_assert(sizeof(value_type) == 1, "multi_searcher supports single-byte character types only");
+
+  private:
+    static constexpr size_type pattern_count = sizeof...(Patterns);
+    static constexpr std::array<string_view_type, pattern_count> _patterns = {string_view_type(Patterns)...};
+
+    static constexpr auto _classes = details::aho_corasick::make_classes(_patterns);
+    static constexpr auto class_count = _classes.second;
+
+    static constexpr size_type state_count = [] {
+        constexpr size_type                                 upper_bound = (Patterns.size() + ...) + 1;
+        std::array<std::uint32_t, upper_bound * class_count> children{};
+        std::array<std::uint32_t, upper_bound>               output{};
+        return details::aho_corasick::make_trie<upper_bound, class_count>(_patterns, _classes.first, children, output);
+    }();
+
+    using state_type = std::conditional_t<state_count * class_count <= 0x10000, std::uint16_t, std::uint32_t>;
+
+    static constexpr auto _automaton = details::aho_corasick::make_automaton<state_count, class_count, state_type>(_patterns, _classes.first);
+
+    // Reports every pattern ending at `end` in state `row`, longest first. Returns false when the callback asked to stop.
+    template <typename TFunction>
+    static constexpr bool report(size_type row, size_type end, TFunction& f)
+    {
+        auto state = static_cast<std::uint32_t>(row / class_count);
+        if (_automaton.output[state] == details::aho_corasick::none)
+            state = _automaton.next_output[state];
+        for (; state != 0; state = _automaton.next_output[state])
+        {
+            const auto      pattern = _automaton.output[state];
+            const multi_match match{pattern, end + 1 - _patterns[pattern].size()};
+            if constexpr (std::is_same_v<std::invoke_result_t<TFunction&, const multi_match&>, bool>)
+            {
+                if (!f(match))
+                    return false;
+            }
+            else
+                f(match);
+        }
+        return true;
+    }
+
+  public:
+    [[nodiscard]] static constexpr size_type        size() noexcept { return pattern_count; }
+    [[nodiscard]] static constexpr string_view_type pattern(size_type i) noexcept { return _patterns[i]; }
+
+    // Calls `f(multi_match)` for every occurrence of every pattern that starts at or after `pos`, ordered by end position
+    // and, for a shared end, longest pattern first. Overlapping occurrences are all reported. If `f` returns bool,
+    // returning false stops the scan.
+    template <typename TFunction>
+    static constexpr void for_each(string_view_type haystack, TFunction&& f, size_type pos = 0)
+    {
+        size_type row = 0;
+        for (size_type i = pos; i < haystack.size(); ++i)
+        {
+            row = _automaton.transitions[row + _classes.first[static_cast<unsigned char>(haystack[i])]];
+            if (row >= _automaton.first_accepting_row && !report(row, i, f))
+                return;
+        }
+    }
+
+    // Returns the occurrence that ends first, the longest one if several end at the same position
+    [[nodiscard]] static constexpr multi_match find(string_view_type haystack, size_type pos = 0)
+    {
+        multi_match result{npos, npos};
+        for_each(
+            haystack,
+            [&](const multi_match& match) {
+                result = match;
+                return false;
+            },
+            pos);
+        return result;
+    }
+
+    [[nodiscard]] static constexpr size_type count(string_view_type haystack)
+    {
+        size_type result = 0;
+        for_each(haystack, [&](const multi_match&) { ++result; });
+        return result;
+    }
+
+    [[nodiscard]] static constexpr bool contains_any(string_view_type haystack) { return static_cast<bool>(find(haystack)); }
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+#endif // FIXSTR_MULTI_SEARCH_HPP
@@ -0,0 +1,602 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_RECORD_HPP
+#define FIXSTR_RECORD_HPP
+
+#include "../fixed_string.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace fixstr
+{
+
+// Padding policies of fixed-width text fields: the value is aligned to one side and the rest is filled with `Pad`
+template <char Pad>
+struct pad_right
+{
+    static constexpr char pad = Pad;
+    static constexpr bool right = true;
+};
+
+template <char Pad>
+struct pad_left
+{
+    static constexpr char pad = Pad;
+    static constexpr bool right = false;
+};
+
+using space_padded = pad_right<' '>; // alphanumeric fields, "AAPL    "
+using zero_padded = pad_left<'0'>;   // numeric text fields, "0001234"
+
+namespace details::padding
+{
+inline unsigned highest_bit(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned index = 0;
+    while (value >>= 1)
+        ++index;
+    return index;
+#endif
+}
+
+inline unsigned lowest_bit(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned index = 0;
+    while ((value & 1) == 0)
+    {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// Bit `i` of the result is set when byte `i` of the block at `p` is not the pad byte
+#if FIXSTR_SSE2_PRESENT
+inline std::uint64_t non_pad_mask_16(const char* p, char pad) noexcept
+{
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(pad)))) ^ 0xffffu;
+}
+#endif // FIXSTR_SSE2_PRESENT
+
+// SWAR variant for 8 bytes: the high bit of byte `i` is set when it is not the pad byte, the byte order is the memory order
+inline std::uint64_t non_pad_mask_8(const char* p, char pad) noexcept
+{
+    constexpr std::uint64_t low7 = 0x7f7f7f7f7f7f7f7fULL;
+    std::uint64_t           word;
+    std::memcpy(&word, p, sizeof(word));
+    if constexpr (!little_endian)
+        word = byteswap(word);
+    const auto x = word ^ (0x0101010101010101ULL * static_cast<unsigned char>(pad));
+    return (((x & low7) + low7) | x) & ~low7;
+}
+
+// Blocks of `Block` bytes covering [0, N), the last one overlaps its predecessor when N is not a multiple of Block.
+// Returns the position of the last byte that is not padding plus one, or 0 for a field of padding only.
+template <size_t N, size_t Block, size_t BitsPerByte, typename TMask>
+size_t value_end(const char* data, char pad, TMask mask) noexcept
+{
+    static_assert(N >= Block);
+    for (size_t end = N; end > Block; end -= Block)
+    {
+        if (const auto bits = mask(data + end - Block, pad))
+            return end - Block + highest_bit(bits) / BitsPerByte + 1;
+    }
+    if (const auto bits = mask(data, pad))
+        return highest_bit(bits) / BitsPerByte + 1;
+    return 0;
+}
+
+// Returns the position of the first byte that is not padding, or N for a field of padding only
+template <size_t N, size_t Block, size_t BitsPerByte, typename TMask>
+size_t value_begin(const char* data, char pad, TMask mask) noexcept
+{
+    static_assert(N >= Block);
+    for (size_t begin = 0; begin + Block < N; begin += Block)
+    {
+        if (const auto bits = mask(data + begin, pad))
+            return begin + lowest_bit(bits) / BitsPerByte;
+    }
+    if (const auto bits = mask(data + N - Block, pad))
+        return N - Block + lowest_bit(bits) / BitsPerByte;
+    return N;
+}
+
+// The value of a left-padded field that starts at `begin`. A zero-padded field of zeros only holds the number 0,
+// so its last digit is kept, other fields of padding only hold an empty value.
+template <size_t N, typename TPadding>
+constexpr std::string_view from_begin(const char* data, size_t begin) noexcept
+{
+    if constexpr (TPadding::pad == '0')
+    {
+        if (begin == N && N > 0)
+            begin = N - 1;
+    }
+    return {data + begin, N - begin};
+}
+
+// The value of a padded field: the bytes left after stripping the padding
+template <size_t N, typename TPadding>
+constexpr std::string_view trimmed(const char* data) noexcept
+{
+    constexpr char pad = TPadding::pad;
+#if FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    if (!FIXSTR_IS_CONSTANT_EVALUATED())
+    {
+#if FIXSTR_SSE2_PRESENT
+        if constexpr (N >= 16)
+        {
+            if constexpr (TPadding::right)
+                return {data, value_end<N, 16, 1>(data, pad, non_pad_mask_16)};
+            else
+                return from_begin<N, TPadding>(data, value_begin<N, 16, 1>(data, pad, non_pad_mask_16));
+        }
+        else
+#endif // FIXSTR_SSE2_PRESENT
+            if constexpr (N >= 8)
+        {
+            if constexpr (TPadding::right)
+                return {data, value_end<N, 8, 8>(data, pad, non_pad_mask_8)};
+            else
+                return from_begin<N, TPadding>(data, value_begin<N, 8, 8>(data, pad, non_pad_mask_8));
+        }
+    }
+#endif // FIXSTR_HAS_IS_CONSTANT_EVALUATED
+    if constexpr (TPadding::right)
+    {
+        size_t end = N;
+        while (end > 0 && data[end - 1] == pad)
+            --end;
+        return {data, end};
+    }
+    else
+    {
+        size_t begin = 0;
+        while (begin < N && data[begin] == pad)
+            ++begin;
+        return from_begin<N, TPadding>(data, begin);
+    }
+}
+
+// Writes `value` into the N bytes at `out` and fills the rest with padding
+template <size_t N, typename TPadding>
+constexpr void encode(char* out, std::string_view value) noexcept
+{
+    const size_t size = value.size() < N ? value.size() : N;
+    const size_t offset = TPadding::right ? 0 : N - size;
+    if constexpr (!TPadding::right)
+        fill(out, out + offset, TPadding::pad);
+    copy(value.data(), value.data() + size, out + offset);
+    if constexpr (TPadding::right)
+        fill(out + size, out + N, TPadding::pad);
+}
+
+[[noreturn]] inline void throw_too_long()
+{
+    throw std::length_error("fixstr: the value does not fit into the field");
+}
+} // namespace details::padding
+
+// A fixed-width padded text field inside an external buffer, such as a field of an exchange message.
+// trimmed() strips the padding with word or SSE2 loads, comparisons ignore the padding.
+template <size_t N, typename TPadding = space_padded>
+class padded_view
+{
+  public:
+    using padding_type = TPadding;
+    static constexpr size_t extent = N;
+
+    constexpr padded_view() noexcept = default;
+    constexpr explicit padded_view(const char* data) noexcept : _raw(data) {}
+    constexpr explicit padded_view(fixed_string_view<N> raw) noexcept : _raw(raw) {}
+
+    [[nodiscard]] constexpr const char*          data() const noexcept { return _raw.data(); }
+    [[nodiscard]] constexpr fixed_string_view<N> raw() const noexcept { return _raw; }
+    [[nodiscard]] constexpr std::string_view     trimmed() const noexcept { return details::padding::trimmed<N, TPadding>(data()); }
+    [[nodiscard]] constexpr bool                 empty() const noexcept { return trimmed().empty(); }
+
+  private:
+    fixed_string_view<N> _raw;
+};
+
+// A fixed-width padded text field that owns its N bytes, with no terminator, ready to be copied into a message
+template <size_t N, typename TPadding = space_padded>
+class padded_string
+{
+  public:
+    using padding_type = TPadding;
+    static constexpr size_t extent = N;
+
+    // A field of padding only
+    constexpr padded_string() noexcept { details::padding::encode<N, TPadding>(_raw.data(), {}); }
+
+    // Throws std::length_error if `value` is longer than the field
+    constexpr explicit padded_string(std::string_view value)
+    {
+        if (value.size() > N)
+            details::padding::throw_too_long();
+        details::padding::encode<N, TPadding>(_raw.data(), value);
+    }
+
+    // Keeps the first N characters of `value`
+    [[nodiscard]] static constexpr padded_string truncate(std::string_view value) noexcept
+    {
+        padded_string result;
+        details::padding::encode<N, TPadding>(result._raw.data(), value);
+        return result;
+    }
+
+    [[nodiscard]] constexpr const char*                  data() const noexcept { return _raw.data(); }
+    [[nodiscard]] constexpr fixed_string_view<N>         raw() const noexcept { return _raw; }
+    [[nodiscard]] constexpr padded_view<N, TPadding>     view() const noexcept { return padded_view<N, TPadding>(data()); }
+    [[nodiscard]] constexpr std::string_view             trimmed() const noexcept { return details::padding::trimmed<N, TPadding>(data()); }
+    [[nodiscard]] constexpr bool                         empty() const noexcept { return trimmed().empty(); }
+
+  private:
+    basic_fixed_string<char, N, std::char_traits<char>, unterminated> _raw;
+};
+
+namespace details::padding
+{
+template <typename T>
+struct is_padded : std::false_type
+{
+};
+
+template <size_t N, typename TPadding>
+struct is_padded<padded_view<N, TPadding>> : std::true_type
+{
+};
+
+template <size_t N, typename TPadding>
+struct is_padded<padded_string<N, TPadding>> : std::true_type
+{
+};
+
+// Padded fields compare with each other and with everything convertible to std::string_view, which is compared with their value
+template <typename TOther>
+constexpr bool is_comparable_v = is_padded<TOther>::value || std::is_convertible_v<const TOther&, std::string_view>;
+
+template <typename T>
+constexpr std::string_view value_of(const T& operand) noexcept
+{
+    if constexpr (is_padded<T>::value)
+        return operand.trimmed();
+    else
+        return std::string_view(operand);
+}
+
+// Right-padded values order as text. Left-padded values are right-aligned numbers or codes, a shorter value orders first
+// and values of the same length order as text, which is the numeric order of zero-padded digits.
+template <typename T, typename = void>
+struct is_left_padded : std::false_type
+{
+};
+
+template <typename T>
+struct is_left_padded<T, std::enable_if_t<is_padded<T>::value>> : std::bool_constant<!T::padding_type::right>
+{
+};
+
+// Fields of the same width and padding compare as raw bytes with the fixed-size kernels: equal raw bytes mean equal values,
+// and the byte order of printable values is the order above.
+template <typename TLhs, typename TRhs, typename = void>
+struct same_layout : std::false_type
+{
+};
+
+template <typename TLhs, typename TRhs>
+struct same_layout<TLhs, TRhs, std::enable_if_t<is_padded<TRhs>::value>>
+    : std::bool_constant<TLhs::extent == TRhs::extent && std::is_same_v<typename TLhs::padding_type, typename TRhs::padding_type>>
+{
+};
+
+template <typename TLhs, typename TRhs>
+constexpr bool same_layout_v = same_layout<TLhs, TRhs>::value;
+
+template <typename TPadded, typename TOther>
+constexpr bool equal(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    if constexpr (same_layout_v<TPadded, TOther>)
+        return fixed_equal<char, std::char_traits<char>, TPadded::extent>(lhs.data(), rhs.data());
+    else
+        return lhs.trimmed() == value_of(rhs);
+}
+
+template <typename TPadded, typename TOther>
+constexpr int compare(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    if constexpr (same_layout_v<TPadded, TOther>)
+        return fixed_compare<char, std::char_traits<char>, TPadded::extent>(lhs.data(), rhs.data());
+    else
+    {
+        const std::string_view lhs_value = lhs.trimmed();
+        const std::string_view rhs_value = value_of(rhs);
+        if constexpr (is_left_padded<TPadded>::value || is_left_padded<TOther>::value)
+        {
+            if (lhs_value.size() != rhs_value.size())
+                return lhs_value.size() < rhs_value.size() ? -1 : 1;
+        }
+        return lhs_value.compare(rhs_value);
+    }
+}
+} // namespace details::padding
+
+#if FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr bool operator==(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return details::padding::equal(lhs, rhs);
+}
+
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr auto operator<=>(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return details::padding::compare(lhs, rhs) <=> 0;
+}
+
+#else
+
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr bool operator==(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return details::padding::equal(lhs, rhs);
+}
+
+template <typename TOther, typename TPadded,
+          std::enable_if_t<!details::padding::is_padded<TOther>::value && details::padding::is_padded<TPadded>::value &&
+                               details::padding::is_comparable_v<TOther>,
+                           int> = 0>
+[[nodiscard]] constexpr bool operator==(const TOther& lhs, const TPadded& rhs) noexcept
+{
+    return details::padding::equal(rhs, lhs);
+}
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr bool operator!=(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return !details::padding::equal(lhs, rhs);
+}
+
+template <typename TOther, typename TPadded,
+          std::enable_if_t<!details::padding::is_padded<TOther>::value && details::padding::is_padded<TPadded>::value &&
+                               details::padding::is_comparable_v<TOther>,
+                           int> = 0>
+[[nodiscard]] constexpr bool operator!=(const TOther& lhs, const TPadded& rhs) noexcept
+{
+    return !details::padding::equal(rhs, lhs);
+}
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr bool operator<(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return details::padding::compare(lhs, rhs) < 0;
+}
+
+template <typename TOther, typename TPadded,
+          std::enable_if_t<!details::padding::is_padded<TOther>::value && details::padding::is_padded<TPadded>::value &&
+                               details::padding::is_comparable_v<TOther>,
+                           int> = 0>
+[[nodiscard]] constexpr bool operator<(const TOther& lhs, const TPadded& rhs) noexcept
+{
+    return details::padding::compare(rhs, lhs) > 0;
+}
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr bool operator<=(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return details::padding::compare(lhs, rhs) <= 0;
+}
+
+template <typename TOther, typename TPadded,
+          std::enable_if_t<!details::padding::is_padded<TOther>::value && details::padding::is_padded<TPadded>::value &&
+                               details::padding::is_comparable_v<TOther>,
+                           int> = 0>
+[[nodiscard]] constexpr bool operator<=(const TOther& lhs, const TPadded& rhs) noexcept
+{
+    return details::padding::compare(rhs, lhs) >= 0;
+}
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr bool operator>(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return details::padding::compare(lhs, rhs) > 0;
+}
+
+template <typename TOther, typename TPadded,
+          std::enable_if_t<!details::padding::is_padded<TOther>::value && details::padding::is_padded<TPadded>::value &&
+                               details::padding::is_comparable_v<TOther>,
+                           int> = 0>
+[[nodiscard]] constexpr bool operator>(const TOther& lhs, const TPadded& rhs) noexcept
+{
+    return details::padding::compare(rhs, lhs) < 0;
+}
+template <typename TPadded, typename TOther,
+          typename = std::enable_if_t<details::padding::is_padded<TPadded>::value && details::padding::is_comparable_v<TOther>>>
+[[nodiscard]] constexpr bool operator>=(const TPadded& lhs, const TOther& rhs) noexcept
+{
+    return details::padding::compare(lhs, rhs) >= 0;
+}
+
+template <typename TOther, typename TPadded,
+          std::enable_if_t<!details::padding::is_padded<TOther>::value && details::padding::is_padded<TPadded>::value &&
+                               details::padding::is_comparable_v<TOther>,
+                           int> = 0>
+[[nodiscard]] constexpr bool operator>=(const TOther& lhs, const TPadded& rhs) noexcept
+{
+    return details::padding::compare(rhs, lhs) <= 0;
+}
+
+#endif // FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+
+template <size_t N, typename TPadding>
+std::ostream& operator<<(std::ostream& out, const padded_view<N, TPadding>& field)
+{
+    return out << field.trimmed();
+}
+
+template <size_t N, typename TPadding>
+std::ostream& operator<<(std::ostream& out, const padded_string<N, TPadding>& field)
+{
+    return out << field.trimmed();
+}
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+// A named field of a record, N bytes wide
+template <basic_fixed_string Name, size_t N, typename TPadding = space_padded>
+struct field
+{
+    static constexpr std::string_view name = Name;
+    static constexpr size_t           size = N;
+    using padding_type = TPadding;
+    using view_type = padded_view<N, TPadding>;
+};
+
+namespace details::padding
+{
+template <typename T>
+struct is_field : std::false_type
+{
+};
+
+template <basic_fixed_string Name, size_t N, typename TPadding>
+struct is_field<field<Name, N, TPadding>> : std::true_type
+{
+};
+} // namespace details::padding
+
+// The layout of a packed fixed-width record: fields follow each other without gaps, in the order of the template arguments.
+// A record refers to a buffer of at least `size` bytes and returns views of its fields, nothing is copied.
+template <typename... TFields>
+class record
+{
+    static_assert((details::padding::is_field<TFields>::value && ...), "record accepts fixstr::field types");
+
+    static constexpr size_t npos = size_t(-1);
+
+    template <basic_fixed_string Name>
+    static constexpr size_t find_index() noexcept
+    {
+        size_t index = npos;
+        size_t i = 0;
+        ((index = TFields::name == std::string_view(Name) && index == npos ? i : index, ++i), ...);
+        return index;
+    }
+
+    static constexpr bool names_are_unique = [] {
+        constexpr std::string_view names[] = {TFields::name...};
+        for (size_t i = 0; i < sizeof...(TFields); ++i)
+            for (size_t j = i + 1; j < sizeof...(TFields); ++j)
+                if (names[i] == names[j])
+                    return false;
+        return true;
+    }();
+    static_assert(names_are_unique, "field names must be unique");
+
+    static constexpr std::array<size_t, sizeof...(TFields) + 1> offsets = [] {
+        std::array<size_t, sizeof...(TFields) + 1> result{};
+        size_t                                      i = 0;
+        ((result[i + 1] = result[i] + TFields::size, ++i), ...);
+        return result;
+    }();
+
+  public:
+    static constexpr size_t size = offsets.back();
+
+    template <basic_fixed_string Name>
+    static constexpr size_t index_of = [] {
+        constexpr size_t index = find_index<Name>();
+        static_assert(index != npos, "the record has no field with this name");
+        return index;
+    }();
+
+    template <basic_fixed_string Name>
+    using field_type = std::tuple_element_t<index_of<Name>, std::tuple<TFields...>>;
+
+    template <basic_fixed_string Name>
+    static constexpr size_t offset_of = offsets[index_of<Name>];
+
+    constexpr explicit record(const char* data) noexcept : _data(data) {}
+
+    // Throws std::length_error if the buffer is shorter than the record
+    constexpr explicit record(std::string_view buffer)
+        : _data(buffer.size() >= size ? buffer.data() : throw std::length_error("fixstr::record: the buffer is too short"))
+    {
+    }
+
+    [[nodiscard]] constexpr const char* data() const noexcept { return _data; }
+
+    template <basic_fixed_string Name>
+    [[nodiscard]] constexpr typename field_type<Name>::view_type get() const noexcept
+    {
+        return typename field_type<Name>::view_type(_data + offset_of<Name>);
+    }
+
+    // Encodes `value` with the padding of the field into a record buffer, throws std::length_error if it does not fit
+    template <basic_fixed_string Name>
+    static constexpr void set(char* data, std::string_view value)
+    {
+        using type = field_type<Name>;
+        if (value.size() > type::size)
+            details::padding::throw_too_long();
+        details::padding::encode<type::size, typename type::padding_type>(data + offset_of<Name>, value);
+    }
+
+  private:
+    const char* _data = nullptr;
+};
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+} // namespace fixstr
+
+#endif // FIXSTR_RECORD_HPP
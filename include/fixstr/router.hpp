@@ -0,0 +1,475 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_ROUTER_HPP
+#define FIXSTR_ROUTER_HPP
+
+#include "../fixed_string.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace fixstr
+{
+
+// A captured path segment. `integer` holds the parsed value of `{name:int}` captures.
+struct route_param
+{
+    std::string_view text;
+    std::int64_t     integer = 0;
+};
+
+template <size_t MaxParams>
+struct route_match
+{
+    static constexpr size_t npos = size_t(-1);
+
+    size_t                             route = npos; // index of the matched route, npos if none matched
+    std::array<route_param, MaxParams> params{};     // captures of the matched route in pattern order
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return route != npos; }
+    [[nodiscard]] constexpr const route_param& operator[](size_t i) const noexcept { return params[i]; }
+};
+
+enum class route_segment_kind : std::uint8_t
+{
+    literal,
+    string,  // "{name}" or "{name:str}", any non-empty segment
+    integer  // "{name:int}", an optionally negative decimal that fits into std::int64_t
+};
+
+struct route_segment
+{
+    route_segment_kind kind = route_segment_kind::literal;
+    std::string_view   text; // the literal text or the name of the capture
+};
+
+namespace details::routing
+{
+inline constexpr std::uint32_t none = std::uint32_t(-1);
+
+// Parses a decimal integer segment, rejecting empty input, stray characters and overflow
+constexpr bool parse_integer(std::string_view text, std::int64_t& value) noexcept
+{
+    const bool negative = !text.empty() && text.front() == '-';
+    if (negative)
+        text.remove_prefix(1);
+    if (text.empty())
+        return false;
+    // up to 18 digits cannot overflow, longer inputs are checked digit by digit
+    std::uint64_t magnitude = 0;
+    const auto    limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) + (negative ? 1 : 0);
+    const bool    checked = text.size() > std::numeric_limits<std::int64_t>::digits10;
+    for (const char ch : text)
+    {
+        const auto digit = static_cast<std::uint64_t>(static_cast<unsigned char>(ch) - unsigned('0'));
+        if (digit > 9 || (checked && magnitude > (limit - digit) / 10))
+            return false;
+        magnitude = magnitude * 10 + digit;
+    }
+    value = negative ? static_cast<std::int64_t>(0 - magnitude) : static_cast<std::int64_t>(magnitude);
+    return true;
+}
+
+constexpr size_t segment_count(std::string_view pattern)
+{
+    if (pattern.empty() || pattern.front() != '/')
+        throw std::logic_error("fixstr::route: a pattern must start with '/'");
+    size_t result = 0;
+    for (const char ch : pattern)
+        result += ch == '/';
+    return result;
+}
+
+template <size_t N>
+constexpr std::array<route_segment, N> parse(std::string_view pattern)
+{
+    std::array<route_segment, N> result{};
+    pattern.remove_prefix(1);
+    for (auto& segment : result)
+    {
+        const auto slash = pattern.find('/');
+        segment.text = pattern.substr(0, slash);
+        pattern.remove_prefix(slash == std::string_view::npos ? pattern.size() : slash + 1);
+
+        const auto open = segment.text.find('{');
+        if (open == std::string_view::npos)
+        {
+            if (segment.text.find('}') != std::string_view::npos)
+                throw std::logic_error("fixstr::route: unmatched '}'");
+            continue;
+        }
+        if (open != 0 || segment.text.back() != '}')
+            throw std::logic_error("fixstr::route: a capture must span a whole segment");
+
+        segment.text = segment.text.substr(1, segment.text.size() - 2);
+        segment.kind = route_segment_kind::string;
+        if (const auto colon = segment.text.find(':'); colon != std::string_view::npos)
+        {
+            const auto type = segment.text.substr(colon + 1);
+            if (type == "int")
+                segment.kind = route_segment_kind::integer;
+            else if (type != "str")
+                throw std::logic_error("fixstr::route: unknown capture type");
+            segment.text = segment.text.substr(0, colon);
+        }
+        if (segment.text.empty() || segment.text.find_first_of("{}") != std::string_view::npos)
+            throw std::logic_error("fixstr::route: invalid capture name");
+    }
+    return result;
+}
+
+// Size of the next segment of a request target, which ends at '/', at the query, at the fragment or at the end of input.
+// Segments are short, so a plain loop beats calls to memchr.
+constexpr size_t segment_size(std::string_view path) noexcept
+{
+    size_t size = 0;
+    while (size < path.size() && path[size] != '/' && path[size] != '?' && path[size] != '#')
+        ++size;
+    return size;
+}
+
+// Lexicographical comparison of two segments of the same size, inlined for the same reason
+constexpr int compare_segment(std::string_view lhs, std::string_view rhs) noexcept
+{
+    for (size_t i = 0; i < lhs.size(); ++i)
+        if (lhs[i] != rhs[i])
+            return static_cast<unsigned char>(lhs[i]) < static_cast<unsigned char>(rhs[i]) ? -1 : 1;
+    return 0;
+}
+
+constexpr bool equal_segment(std::string_view lhs, std::string_view rhs) noexcept
+{
+    return lhs.size() == rhs.size() && compare_segment(lhs, rhs) == 0;
+}
+// Matches one path segment against one pattern segment, storing the capture if there is one
+constexpr bool match_segment(const route_segment& segment, std::string_view text, route_param* param) noexcept
+{
+    switch (segment.kind)
+    {
+    case route_segment_kind::literal:
+        return equal_segment(text, segment.text);
+    case route_segment_kind::string:
+        *param = {text, 0};
+        return !text.empty();
+    case route_segment_kind::integer:
+        *param = {text, 0};
+        return parse_integer(text, param->integer);
+    }
+    return false;
+}
+
+} // namespace details::routing
+
+// A URL path pattern such as "/users/{id:int}/orders/{oid}", parsed at compile time.
+// Segments are separated by '/', a capture spans a whole segment and is a string unless typed with ":int".
+template <basic_fixed_string Pattern>
+struct route
+{
+    static_assert(std::is_same_v<typename decltype(Pattern)::value_type, char>, "route patterns must be char strings");
+
+    static constexpr std::string_view pattern = Pattern;
+    static constexpr size_t           segment_count = details::routing::segment_count(pattern);
+    static constexpr std::array<route_segment, segment_count> segments = details::routing::parse<segment_count>(pattern);
+
+    static constexpr size_t param_count = [] {
+        size_t result = 0;
+        for (const auto& segment : segments)
+            result += segment.kind != route_segment_kind::literal;
+        return result;
+    }();
+
+    // Position of the capture called `Name` among the captures of the route
+    template <basic_fixed_string Name>
+    static constexpr size_t param_index = [] {
+        size_t index = 0;
+        for (const auto& segment : segments)
+        {
+            if (segment.kind == route_segment_kind::literal)
+                continue;
+            if (segment.text == std::string_view(Name))
+                return index;
+            ++index;
+        }
+        throw std::logic_error("fixstr::route: no capture with this name");
+    }();
+
+    // Value of the capture called `Name`: std::int64_t for integer captures, std::string_view otherwise
+    template <basic_fixed_string Name, size_t MaxParams>
+    [[nodiscard]] static constexpr auto get(const route_match<MaxParams>& match) noexcept
+    {
+        constexpr size_t index = param_index<Name>;
+        static_assert(index < MaxParams);
+        constexpr auto kind = [] {
+            size_t i = 0;
+            for (const auto& segment : segments)
+                if (segment.kind != route_segment_kind::literal && i++ == index)
+                    return segment.kind;
+            return route_segment_kind::literal;
+        }();
+        if constexpr (kind == route_segment_kind::integer)
+            return match.params[index].integer;
+        else
+            return match.params[index].text;
+    }
+
+    // Matches this route alone; the route index of a successful match is 0
+    [[nodiscard]] static constexpr route_match<param_count> match(std::string_view target) noexcept
+    {
+        route_match<param_count> result;
+        if (target.empty() || target.front() != '/')
+            return result;
+
+        auto   path = target.substr(1);
+        size_t param = 0;
+        for (size_t i = 0; i < segment_count; ++i)
+        {
+            const auto size = details::routing::segment_size(path);
+            const bool last = size == path.size() || path[size] != '/';
+            if (last != (i + 1 == segment_count))
+                return result;
+            route_param captured;
+            if (!details::routing::match_segment(segments[i], path.substr(0, size), &captured))
+                return result;
+            if (segments[i].kind != route_segment_kind::literal)
+                result.params[param++] = captured;
+            path = last ? std::string_view() : path.substr(size + 1);
+        }
+        result.route = 0;
+        return result;
+    }
+};
+
+namespace details::routing
+{
+template <typename T>
+struct is_route : std::false_type
+{
+};
+
+template <basic_fixed_string Pattern>
+struct is_route<route<Pattern>> : std::true_type
+{
+};
+
+struct node
+{
+    std::uint32_t literal_begin = 0; // literal children are edges [literal_begin, literal_end), sorted by size and text
+    std::uint32_t literal_end = 0;
+    std::uint32_t integer_child = none;
+    std::uint32_t string_child = none;
+    std::uint32_t route = none; // route ending in this node
+};
+
+struct edge
+{
+    std::string_view text;
+    std::uint32_t    child = none;
+};
+
+constexpr bool edge_less(std::string_view lhs, std::string_view rhs) noexcept
+{
+    return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : compare_segment(lhs, rhs) < 0;
+}
+
+// The routes merged into one trie of segments: literal children are looked up by binary search,
+// typed captures are tried after literals, integers before strings.
+template <size_t Nodes>
+struct trie
+{
+    std::array<node, Nodes>     nodes{};
+    std::array<edge, Nodes - 1> edges{};
+};
+
+template <size_t Nodes, typename... TRoutes>
+constexpr trie<Nodes> make_trie()
+{
+    // First pass: a plain trie whose children are kept in per-node linked lists
+    struct draft_edge
+    {
+        route_segment segment;
+        std::uint32_t child = none;
+        std::uint32_t next = none;
+    };
+    std::array<std::uint32_t, Nodes>  first_edge{};
+    std::array<std::uint32_t, Nodes>  routes{};
+    std::array<draft_edge, Nodes - 1> draft{};
+    for (auto& index : first_edge)
+        index = none;
+    for (auto& index : routes)
+        index = none;
+
+    std::uint32_t node_count = 1;
+    std::uint32_t route_index = 0;
+    (
+        [&] {
+            std::uint32_t current = 0;
+            for (const auto& segment : TRoutes::segments)
+            {
+                std::uint32_t found = first_edge[current];
+                while (found != none && (draft[found].segment.kind != segment.kind ||
+                                         (segment.kind == route_segment_kind::literal && draft[found].segment.text != segment.text)))
+                    found = draft[found].next;
+                if (found == none)
+                {
+                    found = node_count - 1;
+                    draft[found] = {segment, node_count++, first_edge[current]};
+                    first_edge[current] = found;
+                }
+                current = draft[found].child;
+            }
+            if (routes[current] != none)
+                throw std::logic_error("fixstr::router: two routes match the same paths");
+            routes[current] = route_index++;
+        }(),
+        ...);
+
+    // Second pass: literal children become contiguous sorted ranges
+    trie<Nodes>   result;
+    std::uint32_t edge_count = 0;
+    for (std::uint32_t n = 0; n < node_count; ++n)
+    {
+        auto& target = result.nodes[n];
+        target.route = routes[n];
+        target.literal_begin = edge_count;
+        for (auto e = first_edge[n]; e != none; e = draft[e].next)
+        {
+            const auto& child = draft[e];
+            if (child.segment.kind == route_segment_kind::integer)
+                target.integer_child = child.child;
+            else if (child.segment.kind == route_segment_kind::string)
+                target.string_child = child.child;
+            else
+            {
+                auto i = edge_count++;
+                for (; i > target.literal_begin && edge_less(child.segment.text, result.edges[i - 1].text); --i)
+                    result.edges[i] = result.edges[i - 1];
+                result.edges[i] = {child.segment.text, child.child};
+            }
+        }
+        target.literal_end = edge_count;
+    }
+    return result;
+}
+} // namespace details::routing
+
+// Matches request paths against several routes in one walk over the path.
+// The routes are merged into a trie during compilation; a path is split into segments once and every segment is looked up
+// among the literal children of the current node first, then matched by the integer and the string captures. Backtracking
+// only happens when a literal or typed branch matches a segment but fails further down.
+template <typename... TRoutes>
+struct router
+{
+    static_assert(sizeof...(TRoutes) > 0, "router requires at least one route");
+    static_assert((details::routing::is_route<TRoutes>::value && ...), "router accepts fixstr::route types");
+
+    static constexpr size_t max_params = std::max({TRoutes::param_count...});
+    using match_type = route_match<max_params>;
+
+    template <size_t I>
+    using route_type = std::tuple_element_t<I, std::tuple<TRoutes...>>;
+
+  private:
+    static constexpr size_t node_count = 1 + (TRoutes::segment_count + ...);
+    static constexpr auto   _trie = details::routing::make_trie<node_count, TRoutes...>();
+
+    static constexpr std::uint32_t find_literal(const details::routing::node& node, std::string_view segment) noexcept
+    {
+        auto first = node.literal_begin;
+        auto last = node.literal_end;
+        while (first < last)
+        {
+            const auto middle = first + (last - first) / 2;
+            if (details::routing::edge_less(_trie.edges[middle].text, segment))
+                first = middle + 1;
+            else
+                last = middle;
+        }
+        return first < node.literal_end && details::routing::equal_segment(_trie.edges[first].text, segment) ? _trie.edges[first].child : details::routing::none;
+    }
+
+    // `path` is what follows the slash that ends the previous segment
+    static constexpr bool descend(std::uint32_t current, std::string_view path, match_type& result, size_t param) noexcept
+    {
+        const auto size = details::routing::segment_size(path);
+        const bool last = size == path.size() || path[size] != '/';
+        const auto segment = path.substr(0, size);
+        const auto rest = last ? std::string_view() : path.substr(size + 1);
+
+        const auto accept = [&](std::uint32_t child, size_t params) {
+            if (!last)
+                return descend(child, rest, result, params);
+            if (_trie.nodes[child].route == details::routing::none)
+                return false;
+            result.route = _trie.nodes[child].route;
+            return true;
+        };
+
+        const auto& node = _trie.nodes[current];
+        if (const auto child = find_literal(node, segment); child != details::routing::none && accept(child, param))
+            return true;
+        if constexpr (max_params > 0)
+        {
+            if (node.integer_child != details::routing::none && details::routing::parse_integer(segment, result.params[param].integer))
+            {
+                result.params[param].text = segment;
+                if (accept(node.integer_child, param + 1))
+                    return true;
+            }
+            if (node.string_child != details::routing::none && !segment.empty())
+            {
+                result.params[param] = {segment, 0};
+                if (accept(node.string_child, param + 1))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+  public:
+    [[nodiscard]] static constexpr size_t size() noexcept { return sizeof...(TRoutes); }
+
+    // Matches the path of a request target, ignoring the query and the fragment
+    [[nodiscard]] static constexpr match_type match(std::string_view target) noexcept
+    {
+        match_type result;
+        if (target.empty() || target.front() != '/' || !descend(0, target.substr(1), result, 0))
+            result.route = match_type::npos;
+        return result;
+    }
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+#endif // FIXSTR_ROUTER_HPP
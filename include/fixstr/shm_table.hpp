@@ -0,0 +1,397 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_SHM_TABLE_HPP
+#define FIXSTR_SHM_TABLE_HPP
+
+#include "../fixed_string.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FIXSTR_SHM_PRESENT 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define FIXSTR_SHM_PRESENT 0
+#endif // FIXSTR_SHM_PRESENT
+
+namespace fixstr
+{
+
+namespace details::shm
+{
+constexpr char          magic[8] = {'F', 'I', 'X', 'S', 'T', 'R', 'S', 'H'};
+constexpr std::uint32_t version = 1;
+constexpr std::uint32_t unused = 0;
+constexpr std::uint32_t occupied = 1;
+constexpr std::uint32_t erased = 2;
+
+// The region starts with the header and the slots follow it, nothing in the region is a pointer,
+// so every process may map it at another address
+struct header
+{
+    char                       magic[8];
+    std::uint32_t              version;
+    std::uint32_t              key_size;
+    std::uint32_t              value_size;
+    std::uint32_t              slot_size;
+    std::uint64_t              slot_count;
+    std::atomic<std::uint64_t> size;
+    std::uint64_t              used; // slots that ever held a key, written by the writer only
+    char                       reserved[16];
+};
+static_assert(sizeof(header) == 64);
+
+// A slot is claimed for a key once and keeps it, erasure only changes its state.
+// The writer makes the sequence odd while it changes the slot, readers copy the slot and retry if the sequence changed.
+// The sequence wraps around after 2^31 writes, so only the state tells a slot that was never used.
+template <size_t N, typename TValue>
+struct slot
+{
+    std::atomic<std::uint32_t> sequence;
+    std::uint32_t              state; // unused, occupied or erased
+    char                       key[N];
+    TValue                     value;
+};
+
+template <size_t N, typename TKey>
+const char* key_data(const TKey& key) noexcept
+{
+    if constexpr (std::is_convertible_v<const TKey&, fixed_string_view<N>>)
+        return fixed_string_view<N>(key).data();
+    else
+    {
+        const std::string_view view(key);
+        return view.size() == N ? view.data() : nullptr;
+    }
+}
+
+template <size_t N, typename TKey>
+constexpr bool is_key_v = std::is_convertible_v<const TKey&, fixed_string_view<N>> || std::is_convertible_v<const TKey&, std::string_view>;
+} // namespace details::shm
+
+// A hash table from fixed_string<N> to trivially copyable values in a shared memory region.
+// One process writes, any number of processes read without locks: every slot is a seqlock, so a reader never blocks
+// and never sees a partially written value, it retries the slot instead. Keys are never moved, erasure leaves the key
+// in its slot, and the capacity is fixed when the region is created.
+// The capacity counts every distinct key ever inserted, erased ones included: a table whose keys churn has to be recreated
+// once it is reached.
+template <size_t N, typename TValue>
+class shm_table
+{
+    static_assert(std::is_trivially_copyable_v<TValue>, "values are copied between processes byte by byte");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free && std::atomic<std::uint64_t>::is_always_lock_free,
+                  "atomics in shared memory must be lock-free");
+
+    using slot_type = details::shm::slot<N, TValue>;
+    using header_type = details::shm::header;
+
+  public:
+    // The size of a region for `capacity` distinct keys. The table has twice as many slots, rounded up to a power of two,
+    // so that lookups stay short.
+    [[nodiscard]] static constexpr size_t required_size(size_t capacity) noexcept { return sizeof(header_type) + slots_for(capacity) * sizeof(slot_type); }
+
+    // Lays out an empty table in a region of at least required_size(capacity) bytes
+    [[nodiscard]] static shm_table create(void* region, size_t size, size_t capacity)
+    {
+        check_region(region, size, required_size(capacity));
+        std::memset(region, 0, required_size(capacity));
+        const size_t slot_count = slots_for(capacity);
+        auto* header = ::new (region) header_type{};
+        std::memcpy(header->magic, details::shm::magic, sizeof(header->magic));
+        header->version = details::shm::version;
+        header->key_size = N;
+        header->value_size = sizeof(TValue);
+        header->slot_size = sizeof(slot_type);
+        header->slot_count = slot_count;
+        auto* slots = reinterpret_cast<slot_type*>(header + 1);
+        for (size_t i = 0; i < slot_count; ++i)
+            ::new (static_cast<void*>(slots + i)) slot_type{};
+        return shm_table(header);
+    }
+
+    // Uses a table created by another process, throws std::runtime_error if the region does not hold one of this type
+    [[nodiscard]] static shm_table attach(void* region, size_t size)
+    {
+        check_region(region, size, sizeof(header_type));
+        auto* header = static_cast<header_type*>(region);
+        if (std::memcmp(header->magic, details::shm::magic, sizeof(header->magic)) != 0 || header->version != details::shm::version)
+            throw std::runtime_error("fixstr::shm_table: the region does not hold a table");
+        if (header->key_size != N || header->value_size != sizeof(TValue) || header->slot_size != sizeof(slot_type))
+            throw std::runtime_error("fixstr::shm_table: the table has another key or value type");
+        const auto slot_count = header->slot_count;
+        if (slot_count == 0 || (slot_count & (slot_count - 1)) != 0 || slot_count > (size - sizeof(header_type)) / sizeof(slot_type))
+            throw std::runtime_error("fixstr::shm_table: the region is smaller than the table");
+        return shm_table(header);
+    }
+
+#if FIXSTR_SHM_PRESENT
+    // Creates or replaces the POSIX shared memory object `name` ("/symbols") and lays out an empty table in it
+    [[nodiscard]] static shm_table create_shared(const std::string& name, size_t capacity)
+    {
+        const size_t size = required_size(capacity);
+        const int    fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "fixstr::shm_table: unable to create " + name);
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fixstr::shm_table: unable to resize " + name);
+        }
+        void* region = map(fd, size, name);
+        shm_table table = create(region, size, capacity);
+        table._mapping_size = size;
+        return table;
+    }
+
+    // Maps the table of the POSIX shared memory object `name`
+    [[nodiscard]] static shm_table open_shared(const std::string& name)
+    {
+        const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "fixstr::shm_table: unable to open " + name);
+        struct stat status;
+        if (::fstat(fd, &status) != 0)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fixstr::shm_table: unable to stat " + name);
+        }
+        const auto size = static_cast<size_t>(status.st_size);
+        if (size < sizeof(header_type))
+        {
+            ::close(fd);
+            throw std::runtime_error("fixstr::shm_table: the region does not hold a table");
+        }
+        void* region = map(fd, size, name);
+        try
+        {
+            shm_table table = attach(region, size);
+            table._mapping_size = size;
+            return table;
+        }
+        catch (...)
+        {
+            ::munmap(region, size);
+            throw;
+        }
+    }
+
+    // Removes the name, the processes that mapped the table keep using it
+    static void remove_shared(const std::string& name) noexcept { ::shm_unlink(name.c_str()); }
+#endif // FIXSTR_SHM_PRESENT
+
+    shm_table(const shm_table&) = delete;
+    shm_table& operator=(const shm_table&) = delete;
+
+    shm_table(shm_table&& other) noexcept : _header(std::exchange(other._header, nullptr)), _mapping_size(std::exchange(other._mapping_size, 0)) {}
+
+    shm_table& operator=(shm_table&& other) noexcept
+    {
+        std::swap(_header, other._header);
+        std::swap(_mapping_size, other._mapping_size);
+        return *this;
+    }
+
+    ~shm_table() { unmap(); }
+
+    // Distinct keys the table accepts, erased ones included
+    [[nodiscard]] size_t capacity() const noexcept { return slot_count() / 2; }
+
+    // Keys that were inserted and not erased
+    [[nodiscard]] size_t size() const noexcept { return static_cast<size_t>(_header->size.load(std::memory_order_relaxed)); }
+
+    // Readers: lock-free, a key of another size is not found
+    template <typename TKey, typename = std::enable_if_t<details::shm::is_key_v<N, TKey>>>
+    [[nodiscard]] std::optional<TValue> find(const TKey& key) const noexcept
+    {
+        const char* data = details::shm::key_data<N>(key);
+        if (data == nullptr)
+            return std::nullopt;
+        const size_t mask = slot_count() - 1;
+        size_t       index = hash{}(fixed_string_view<N>(data)) & mask;
+        for (size_t probes = 0; probes <= mask; ++probes, index = (index + 1) & mask)
+        {
+            slot_type copy;
+            if (!read(slots()[index], copy))
+                return std::nullopt;
+            if (details::fixed_equal<char, std::char_traits<char>, N>(copy.key, data))
+                return copy.state == details::shm::occupied ? std::optional<TValue>(copy.value) : std::nullopt;
+        }
+        return std::nullopt;
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::shm::is_key_v<N, TKey>>>
+    [[nodiscard]] bool contains(const TKey& key) const noexcept
+    {
+        return find(key).has_value();
+    }
+
+    // Writer: a single thread of a single process at a time.
+    // Throws std::length_error for keys that are not N characters long and for a new key when capacity() keys were inserted.
+    template <typename TKey, typename = std::enable_if_t<details::shm::is_key_v<N, TKey>>>
+    bool insert_or_assign(const TKey& key, const TValue& value)
+    {
+        const char* data = details::shm::key_data<N>(key);
+        if (data == nullptr)
+            throw std::length_error("fixstr::shm_table: the key size differs from the key size of the table");
+        slot_type* slot = find_slot(data);
+        const bool claimed = slot != nullptr && slot->state == details::shm::unused;
+        if (slot == nullptr || (claimed && _header->used >= capacity()))
+            throw std::length_error("fixstr::shm_table: the table is full");
+        if (claimed)
+            ++_header->used;
+        const bool inserted = claimed || slot->state != details::shm::occupied;
+        write(*slot, [&](slot_type& target) {
+            std::memcpy(target.key, data, N);
+            target.value = value;
+            target.state = details::shm::occupied;
+        });
+        if (inserted)
+            _header->size.fetch_add(1, std::memory_order_relaxed);
+        return inserted;
+    }
+
+    template <typename TKey, typename = std::enable_if_t<details::shm::is_key_v<N, TKey>>>
+    bool erase(const TKey& key) noexcept
+    {
+        const char* data = details::shm::key_data<N>(key);
+        if (data == nullptr)
+            return false;
+        slot_type* slot = find_slot(data);
+        if (slot == nullptr || slot->state != details::shm::occupied)
+            return false;
+        write(*slot, [](slot_type& target) { target.state = details::shm::erased; });
+        _header->size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+  private:
+    explicit shm_table(header_type* header) noexcept : _header(header) {}
+
+    static constexpr size_t slots_for(size_t capacity) noexcept
+    {
+        size_t result = 16;
+        while (result < capacity * 2)
+            result *= 2;
+        return result;
+    }
+
+    static void check_region(void* region, size_t size, size_t required)
+    {
+        if (reinterpret_cast<std::uintptr_t>(region) % alignof(slot_type) != 0 || reinterpret_cast<std::uintptr_t>(region) % alignof(header_type) != 0)
+            throw std::invalid_argument("fixstr::shm_table: the region is misaligned");
+        if (size < required)
+            throw std::length_error("fixstr::shm_table: the region is too small");
+    }
+
+#if FIXSTR_SHM_PRESENT
+    static void* map(int fd, size_t size, const std::string& name)
+    {
+        void*     region = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (region == MAP_FAILED)
+            throw std::system_error(error, std::generic_category(), "fixstr::shm_table: unable to map " + name);
+        return region;
+    }
+#endif // FIXSTR_SHM_PRESENT
+
+    void unmap() noexcept
+    {
+#if FIXSTR_SHM_PRESENT
+        if (_mapping_size != 0)
+            ::munmap(_header, _mapping_size);
+#endif // FIXSTR_SHM_PRESENT
+        _header = nullptr;
+        _mapping_size = 0;
+    }
+
+    size_t     slot_count() const noexcept { return static_cast<size_t>(_header->slot_count); }
+    slot_type* slots() const noexcept { return reinterpret_cast<slot_type*>(_header + 1); }
+
+    // Copies a slot that is not being written, returns false for a slot that was never used
+    static bool read(const slot_type& slot, slot_type& copy) noexcept
+    {
+        for (;;)
+        {
+            const auto before = slot.sequence.load(std::memory_order_acquire);
+            if (before % 2 == 0)
+            {
+                std::memcpy(&copy.state, &slot.state, sizeof(slot_type) - offsetof(slot_type, state));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == before)
+                    return copy.state != details::shm::unused;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename TUpdate>
+    static void write(slot_type& slot, TUpdate update) noexcept
+    {
+        const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        update(slot);
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // The writer's slot for the key: the one holding it or the first never used one, nullptr if the table is full
+    slot_type* find_slot(const char* key) const noexcept
+    {
+        const size_t mask = slot_count() - 1;
+        size_t       index = hash{}(fixed_string_view<N>(key)) & mask;
+        for (size_t probes = 0; probes <= mask; ++probes, index = (index + 1) & mask)
+        {
+            slot_type& slot = slots()[index];
+            if (slot.state == details::shm::unused || details::fixed_equal<char, std::char_traits<char>, N>(slot.key, key))
+                return &slot;
+        }
+        return nullptr;
+    }
+
+    header_type* _header = nullptr;
+    size_t       _mapping_size = 0;
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_SHM_TABLE_HPP
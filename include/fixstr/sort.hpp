@@ -0,0 +1,282 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_SORT_HPP
+#define FIXSTR_SORT_HPP
+
+#include "../fixed_string.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fixstr
+{
+
+namespace details::radix
+{
+// The size of a fixed string type, including the types derived from basic_fixed_string such as fixed_string
+template <typename TChar, size_t N, typename TStorage>
+std::integral_constant<size_t, N> key_size_of(const basic_fixed_string<TChar, N, std::char_traits<TChar>, TStorage>&);
+
+// The byte order of single-byte characters with standard traits is the order of operator<
+template <typename T>
+constexpr size_t key_size_v = decltype(key_size_of(std::declval<const T&>()))::value;
+
+// Buckets smaller than this are sorted by comparisons, which use the fixed-size word kernels
+constexpr size_t small_bucket = 64;
+
+// Inputs smaller than this are not worth the threads
+constexpr size_t parallel_threshold = size_t(1) << 16;
+
+template <typename T>
+unsigned byte_at(const T& key, size_t depth) noexcept
+{
+    return static_cast<unsigned char>(key[depth]);
+}
+
+// In-place MSD radix sort ("American flag sort") of keys whose first `depth` bytes are equal
+template <size_t N, typename RandomIt>
+void sort_range(RandomIt first, RandomIt last, size_t depth)
+{
+    static_assert(sizeof(typename std::iterator_traits<RandomIt>::value_type::value_type) == 1,
+                  "fixstr::sort sorts fixed strings of single-byte characters");
+    using std::swap;
+    for (;;)
+    {
+        const auto size = static_cast<size_t>(last - first);
+        if (size < small_bucket)
+        {
+            std::sort(first, last);
+            return;
+        }
+        if (depth == N)
+            return;
+
+        std::array<size_t, 256> counts{};
+        for (auto it = first; it != last; ++it)
+            ++counts[byte_at(*it, depth)];
+
+        // a byte shared by all keys is skipped without moving them
+        if (counts[byte_at(*first, depth)] == size)
+        {
+            ++depth;
+            continue;
+        }
+
+        std::array<size_t, 256> next;
+        std::array<size_t, 256> end;
+        size_t                  offset = 0;
+        for (size_t b = 0; b < 256; ++b)
+        {
+            next[b] = offset;
+            offset += counts[b];
+            end[b] = offset;
+        }
+        for (size_t b = 0; b < 256; ++b)
+        {
+            while (next[b] < end[b])
+            {
+                const unsigned target = byte_at(first[next[b]], depth);
+                if (target == b)
+                    ++next[b];
+                else
+                    swap(first[next[b]], first[next[target]++]);
+            }
+        }
+
+        size_t begin = 0;
+        for (size_t b = 0; b < 256; ++b)
+        {
+            if (counts[b] > 1)
+                sort_range<N>(first + begin, first + begin + counts[b], depth + 1);
+            begin += counts[b];
+        }
+        return;
+    }
+}
+
+// Sorts in parallel and, with `unique`, removes duplicates. Returns the number of the remaining keys.
+// Threads find the leading bytes shared by all keys, such as a common symbol prefix, then histogram and scatter their chunks
+// by the first byte that differs into a buffer. Every top-level bucket becomes a task: idle threads take the largest
+// remaining bucket, move it back and radix sort it in place.
+template <typename RandomIt>
+size_t parallel_sort(RandomIt first, RandomIt last, unsigned threads, bool unique)
+{
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    constexpr size_t N = key_size_v<value_type>;
+
+    const auto size = static_cast<size_t>(last - first);
+    const auto chunk = (size + threads - 1) / threads;
+
+    std::vector<std::array<size_t, 256>> counts(threads);
+    const auto                           run = [threads](auto&& work) {
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; ++t)
+            workers.emplace_back(work, t);
+        work(0u);
+        for (auto& worker : workers)
+            worker.join();
+    };
+    const auto chunk_bounds = [&](unsigned t) {
+        const size_t begin = std::min(size, t * chunk);
+        return std::pair<size_t, size_t>(begin, std::min(size, begin + chunk));
+    };
+
+    std::vector<size_t> prefixes(threads);
+    run([&](unsigned t) {
+        size_t prefix = N;
+        const auto [begin, end] = chunk_bounds(t);
+        for (size_t i = begin; i < end && prefix > 0; ++i)
+        {
+            size_t shared = 0;
+            while (shared < prefix && byte_at(first[i], shared) == byte_at(*first, shared))
+                ++shared;
+            prefix = shared;
+        }
+        prefixes[t] = prefix;
+    });
+    const size_t depth = *std::min_element(prefixes.begin(), prefixes.end());
+    if (depth == N)
+        return unique ? 1 : size;
+
+    run([&](unsigned t) {
+        auto& local = counts[t];
+        local.fill(0);
+        const auto [begin, end] = chunk_bounds(t);
+        for (size_t i = begin; i < end; ++i)
+            ++local[byte_at(first[i], depth)];
+    });
+
+    std::array<size_t, 257> bucket_begin{};
+    for (size_t b = 0; b < 256; ++b)
+    {
+        size_t total = 0;
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            const size_t count = counts[t][b];
+            counts[t][b] = bucket_begin[b] + total;
+            total += count;
+        }
+        bucket_begin[b + 1] = bucket_begin[b] + total;
+    }
+
+    std::vector<value_type> buffer(size);
+    run([&](unsigned t) {
+        auto& offsets = counts[t];
+        const auto [begin, end] = chunk_bounds(t);
+        for (size_t i = begin; i < end; ++i)
+            buffer[offsets[byte_at(first[i], depth)]++] = std::move(first[i]);
+    });
+
+    std::array<size_t, 256> order;
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return bucket_begin[lhs + 1] - bucket_begin[lhs] > bucket_begin[rhs + 1] - bucket_begin[rhs];
+    });
+
+    std::array<size_t, 256> kept{};
+    std::atomic<size_t>     next_task{0};
+    run([&](unsigned) {
+        for (size_t task = next_task++; task < 256; task = next_task++)
+        {
+            const size_t b = order[task];
+            const auto   bucket_first = first + static_cast<std::ptrdiff_t>(bucket_begin[b]);
+            const auto   bucket_last = first + static_cast<std::ptrdiff_t>(bucket_begin[b + 1]);
+            std::move(buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b]),
+                      buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b + 1]), bucket_first);
+            sort_range<N>(bucket_first, bucket_last, depth + 1);
+            kept[b] = unique ? static_cast<size_t>(std::unique(bucket_first, bucket_last) - bucket_first) : bucket_begin[b + 1] - bucket_begin[b];
+        }
+    });
+
+    if (!unique)
+        return size;
+    // the unique keys of every bucket move left, next to those of the previous buckets
+    size_t out = 0;
+    for (size_t b = 0; b < 256; ++b)
+    {
+        const auto bucket_first = first + static_cast<std::ptrdiff_t>(bucket_begin[b]);
+        if (out != bucket_begin[b])
+            std::move(bucket_first, bucket_first + static_cast<std::ptrdiff_t>(kept[b]), first + static_cast<std::ptrdiff_t>(out));
+        out += kept[b];
+    }
+    return out;
+}
+
+inline unsigned thread_count(unsigned threads) noexcept
+{
+    if (threads != 0)
+        return threads;
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+}
+} // namespace details::radix
+
+// Sorts fixed strings of single-byte characters in the order of operator< with an MSD radix sort on their bytes
+template <typename RandomIt>
+void sort(RandomIt first, RandomIt last)
+{
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    details::radix::sort_range<details::radix::key_size_v<value_type>>(first, last, 0);
+}
+
+// Sorts with `threads` threads, all hardware threads if it is 0. Small inputs are sorted by the calling thread.
+template <typename RandomIt>
+void sort(RandomIt first, RandomIt last, unsigned threads)
+{
+    threads = details::radix::thread_count(threads);
+    if (threads == 1 || static_cast<size_t>(last - first) < details::radix::parallel_threshold)
+        fixstr::sort(first, last);
+    else
+        details::radix::parallel_sort(first, last, threads, false);
+}
+
+// Sorts and removes duplicates, returns the end of the unique keys like std::unique
+template <typename RandomIt>
+RandomIt sort_unique(RandomIt first, RandomIt last)
+{
+    fixstr::sort(first, last);
+    return std::unique(first, last);
+}
+
+template <typename RandomIt>
+RandomIt sort_unique(RandomIt first, RandomIt last, unsigned threads)
+{
+    threads = details::radix::thread_count(threads);
+    if (threads == 1 || static_cast<size_t>(last - first) < details::radix::parallel_threshold)
+        return fixstr::sort_unique(first, last);
+    return first + static_cast<std::ptrdiff_t>(details::radix::parallel_sort(first, last, threads, true));
+}
+
+} // namespace fixstr
+
+#endif // FIXSTR_SORT_HPP
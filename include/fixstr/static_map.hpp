@@ -0,0 +1,293 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_STATIC_MAP_HPP
+#define FIXSTR_STATIC_MAP_HPP
+
+#include "../fixed_string.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace fixstr
+{
+
+template <typename TKey, typename TValue>
+struct map_entry
+{
+    TKey   key;
+    TValue value;
+};
+
+template <typename TKey, typename TValue>
+map_entry(TKey, TValue) -> map_entry<TKey, TValue>;
+
+template <typename TChar, size_t N, typename TValue>
+map_entry(const TChar (&)[N], TValue) -> map_entry<basic_fixed_string<TChar, N - 1>, TValue>;
+
+namespace details::phf
+{
+constexpr std::uint64_t golden_ratio = 0x9e3779b97f4a7c15ULL;
+
+constexpr std::uint64_t fmix64(std::uint64_t h) noexcept
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+template <typename TChar, typename TTraits>
+constexpr std::uint64_t hash(std::basic_string_view<TChar, TTraits> str, std::uint64_t seed) noexcept
+{
+    return fixstr::hashing::wyhash::hash(details::hashing::byte_reader<TChar>{str.data()}, str.size() * sizeof(TChar), seed);
+}
+
+constexpr size_t ceil_pow2(size_t n) noexcept
+{
+    size_t result = 1;
+    while (result < n)
+        result <<= 1;
+    return result;
+}
+
+constexpr size_t bucket_of(std::uint64_t h, size_t bucket_count) noexcept
+{
+    return static_cast<size_t>(((fmix64(h) >> 32) * bucket_count) >> 32);
+}
+
+constexpr size_t slot_of(std::uint64_t h, std::uint32_t displacement, size_t slot_count) noexcept
+{
+    return static_cast<size_t>(fmix64(h + (displacement + 1) * golden_ratio)) & (slot_count - 1);
+}
+
+template <size_t B, size_t M>
+struct table
+{
+    std::uint64_t                seed = 0;
+    std::array<std::uint32_t, B> displacements{};
+    std::array<std::uint32_t, M> slots{};
+};
+
+// "Hash and displace": keys are grouped into B buckets and every bucket, largest first,
+// gets the smallest displacement that moves all of its keys into free slots.
+// Sets `collided` if two distinct keys have the same hash with this seed, no displacement tells them apart.
+template <size_t B, size_t M, typename TString, size_t K>
+constexpr table<B, M> build_with_seed(const std::array<TString, K>& keys, std::uint64_t seed, bool& collided)
+{
+    table<B, M> result;
+    result.seed = seed;
+    for (auto& slot : result.slots)
+        slot = K;
+
+    std::array<std::uint64_t, K> hashes{};
+    for (size_t i = 0; i < K; ++i)
+        hashes[i] = hash(keys[i], seed);
+
+    std::array<size_t, B + 1> bucket_start{};
+    for (const auto h : hashes)
+        ++bucket_start[bucket_of(h, B) + 1];
+    size_t max_bucket_size = 0;
+    for (size_t b = 0; b < B; ++b)
+    {
+        max_bucket_size = std::max(max_bucket_size, bucket_start[b + 1]);
+        bucket_start[b + 1] += bucket_start[b];
+    }
+
+    std::array<size_t, K> members{};
+    std::array<size_t, B> fill = {};
+    for (size_t i = 0; i < K; ++i)
+    {
+        const auto b = bucket_of(hashes[i], B);
+        for (size_t k = bucket_start[b]; k < bucket_start[b] + fill[b]; ++k)
+        {
+            if (hashes[members[k]] != hashes[i])
+                continue;
+            if (keys[members[k]] == keys[i])
+                throw std::logic_error("fixstr::static_map: duplicate keys");
+            collided = true;
+            return result;
+        }
+        members[bucket_start[b] + fill[b]++] = i;
+    }
+
+    std::array<size_t, K> candidate{};
+    for (size_t bucket_size = max_bucket_size; bucket_size > 0; --bucket_size)
+    {
+        for (size_t b = 0; b < B; ++b)
+        {
+            if (bucket_start[b + 1] - bucket_start[b] != bucket_size)
+                continue;
+
+            for (std::uint32_t d = 0;; ++d)
+            {
+                if (d == std::uint32_t(-1))
+                    throw std::logic_error("fixstr::static_map: unable to build a perfect hash");
+
+                bool fits = true;
+                for (size_t k = 0; fits && k < bucket_size; ++k)
+                {
+                    candidate[k] = slot_of(hashes[members[bucket_start[b] + k]], d, M);
+                    fits = result.slots[candidate[k]] == K;
+                    for (size_t l = 0; fits && l < k; ++l)
+                        fits = candidate[l] != candidate[k];
+                }
+                if (!fits)
+                    continue;
+
+                for (size_t k = 0; k < bucket_size; ++k)
+                    result.slots[candidate[k]] = static_cast<std::uint32_t>(members[bucket_start[b] + k]);
+                result.displacements[b] = d;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+// Key sets with a hash collision are hashed again with the next seed
+template <size_t B, size_t M, typename TString, size_t K>
+constexpr table<B, M> build(const std::array<TString, K>& keys)
+{
+    for (std::uint64_t seed = 0;; ++seed)
+    {
+        bool       collided = false;
+        const auto result = build_with_seed<B, M>(keys, seed, collided);
+        if (!collided)
+            return result;
+    }
+}
+
+template <typename T, typename...>
+struct first
+{
+    using type = T;
+};
+} // namespace details::phf
+
+// Immutable map whose keys are known at compile time.
+// Lookup hashes the key once, reads one slot and performs one length-checked comparison.
+template <auto... Entries>
+struct static_map
+{
+    static_assert(sizeof...(Entries) > 0, "static_map requires at least one entry");
+
+    using string_view_type = typename details::phf::first<typename decltype(Entries.key)::string_view_type...>::type;
+    static_assert((std::is_same_v<string_view_type, typename decltype(Entries.key)::string_view_type> && ...),
+                  "all keys of static_map must have the same character type and traits");
+
+    using mapped_type = typename details::phf::first<decltype(Entries.value)...>::type;
+    using value_type = typename string_view_type::value_type;
+    using traits_type = typename string_view_type::traits_type;
+    using size_type = size_t;
+    static constexpr auto npos = string_view_type::npos;
+
+  private:
+    static constexpr size_type key_count = sizeof...(Entries);
+    static constexpr size_type bucket_count = (key_count + 3) / 4;
+    static constexpr size_type slot_count = details::phf::ceil_pow2(key_count + key_count / 2);
+
+    static constexpr size_type total_key_size = (static_cast<string_view_type>(Entries.key).size() + ...);
+
+    struct key_location
+    {
+        std::uint32_t offset;
+        std::uint32_t size;
+    };
+
+    static constexpr auto make_key_storage()
+    {
+        std::array<value_type, total_key_size + 1> chars{};
+        std::array<key_location, key_count>        locations{};
+        size_type                                  offset = 0;
+        size_type                                  i = 0;
+        (
+            [&] {
+                const string_view_type key = Entries.key;
+                details::copy(key.begin(), key.end(), chars.begin() + offset);
+                locations[i++] = {static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(key.size())};
+                offset += key.size();
+            }(),
+            ...);
+        return std::pair{chars, locations};
+    }
+
+    static constexpr auto key_storage = make_key_storage();
+    static constexpr std::array<mapped_type, key_count> _values = {static_cast<mapped_type>(Entries.value)...};
+    static constexpr auto table =
+        details::phf::build<bucket_count, slot_count>(std::array<string_view_type, key_count>{static_cast<string_view_type>(Entries.key)...});
+
+  public:
+    [[nodiscard]] static constexpr size_type size() noexcept { return key_count; }
+    [[nodiscard]] static constexpr bool      empty() noexcept { return false; }
+
+    [[nodiscard]] static constexpr string_view_type key(size_type i) noexcept
+    {
+        const auto location = key_storage.second[i];
+        return {key_storage.first.data() + location.offset, location.size};
+    }
+    [[nodiscard]] static constexpr const mapped_type& value(size_type i) noexcept { return _values[i]; }
+
+    // Returns the position of `key` in the template argument list or `npos`
+    [[nodiscard]] static constexpr size_type index_of(string_view_type key) noexcept
+    {
+        const auto h = details::phf::hash(key, table.seed);
+        const auto d = table.displacements[details::phf::bucket_of(h, bucket_count)];
+        const auto i = table.slots[details::phf::slot_of(h, d, slot_count)];
+        if (i == key_count)
+            return npos;
+        const auto location = key_storage.second[i];
+        if (location.size != key.size() || traits_type::compare(key_storage.first.data() + location.offset, key.data(), key.size()) != 0)
+            return npos;
+        return i;
+    }
+
+    [[nodiscard]] static constexpr const mapped_type* find(string_view_type key) noexcept
+    {
+        const auto i = index_of(key);
+        return i == npos ? nullptr : &_values[i];
+    }
+
+    [[nodiscard]] static constexpr bool contains(string_view_type key) noexcept { return index_of(key) != npos; }
+
+    [[nodiscard]] static constexpr const mapped_type& at(string_view_type key)
+    {
+        const auto i = index_of(key);
+        if (i == npos)
+            throw std::out_of_range("fixstr::static_map::at");
+        return _values[i];
+    }
+};
+
+} // namespace fixstr
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+#endif // FIXSTR_STATIC_MAP_HPP
@@ -0,0 +1,287 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_STRING_SWITCH_HPP
+#define FIXSTR_STRING_SWITCH_HPP
+
+#include "../fixed_string.hpp"
+#include "static_map.hpp"
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace fixstr
+{
+
+enum class string_switch_strategy
+{
+    linear,          // few keys: length check, then comparison, key by key
+    length_and_byte, // the length picks a bucket, one byte where the keys of the bucket differ picks the only candidate
+    perfect_hash     // static_map's perfect hash
+};
+
+namespace details::switching
+{
+inline constexpr std::uint8_t none = 0xff;
+inline constexpr size_t       max_linear_keys = 4;
+inline constexpr size_t       max_decision_length = 255;
+inline constexpr size_t       max_decision_tables = 32;
+
+template <typename TChar>
+constexpr size_t low_byte(TChar ch) noexcept
+{
+    return static_cast<size_t>(static_cast<std::make_unsigned_t<TChar>>(ch) & 0xff);
+}
+
+// Position where the low bytes of all keys of the given length differ, npos if there is none
+template <size_t N, typename TStringView>
+constexpr size_t discriminating_position(const std::array<TStringView, N>& keys, size_t length) noexcept
+{
+    for (size_t position = 0; position < length; ++position)
+    {
+        std::array<bool, 256> seen{};
+        bool                  distinct = true;
+        for (size_t k = 0; distinct && k < N; ++k)
+        {
+            if (keys[k].size() != length)
+                continue;
+            auto& byte_seen = seen[low_byte(keys[k][position])];
+            distinct = !byte_seen;
+            byte_seen = true;
+        }
+        if (distinct)
+            return position;
+    }
+    return size_t(-1);
+}
+
+struct length_entry
+{
+    std::uint8_t  key = none;   // the only key of this length, or `none` if the length has zero or several keys
+    std::uint8_t  table = none; // byte table for a length shared by several keys
+    std::uint16_t position = 0; // position of the byte indexing `table`
+};
+
+template <size_t N, typename TStringView>
+constexpr size_t max_length(const std::array<TStringView, N>& keys) noexcept
+{
+    size_t result = 0;
+    for (const auto key : keys)
+        result = key.size() > result ? key.size() : result;
+    return result;
+}
+
+// Number of byte tables the length-and-byte strategy needs, or npos if it cannot tell some keys apart
+template <size_t N, typename TStringView>
+constexpr size_t decision_table_count(const std::array<TStringView, N>& keys) noexcept
+{
+    const auto longest = max_length(keys);
+    if (N >= none || longest > max_decision_length)
+        return size_t(-1);
+    size_t tables = 0;
+    for (size_t length = 0; length <= longest; ++length)
+    {
+        size_t keys_of_length = 0;
+        for (const auto key : keys)
+            keys_of_length += key.size() == length;
+        if (keys_of_length < 2)
+            continue;
+        if (discriminating_position(keys, length) == size_t(-1))
+            return size_t(-1);
+        ++tables;
+    }
+    return tables;
+}
+
+template <size_t Lengths, size_t Tables>
+struct decision_tree
+{
+    std::array<length_entry, Lengths>                 lengths{};
+    std::array<std::array<std::uint8_t, 256>, Tables> tables{};
+};
+
+template <size_t Lengths, size_t Tables, size_t N, typename TStringView>
+constexpr decision_tree<Lengths, Tables> make_decision_tree(const std::array<TStringView, N>& keys) noexcept
+{
+    decision_tree<Lengths, Tables> result;
+    for (auto& table : result.tables)
+        for (auto& key : table)
+            key = none;
+
+    size_t table_count = 0;
+    for (size_t length = 0; length < Lengths; ++length)
+    {
+        auto&  entry = result.lengths[length];
+        size_t keys_of_length = 0;
+        for (size_t k = 0; k < N; ++k)
+            if (keys[k].size() == length)
+            {
+                entry.key = static_cast<std::uint8_t>(k);
+                ++keys_of_length;
+            }
+        if (keys_of_length < 2)
+            continue;
+
+        entry.key = none;
+        entry.table = static_cast<std::uint8_t>(table_count);
+        entry.position = static_cast<std::uint16_t>(discriminating_position(keys, length));
+        for (size_t k = 0; k < N; ++k)
+            if (keys[k].size() == length)
+                result.tables[table_count][low_byte(keys[k][entry.position])] = static_cast<std::uint8_t>(k);
+        ++table_count;
+    }
+    return result;
+}
+
+template <typename TVisitor, size_t I>
+constexpr decltype(auto) visit_index(TVisitor& visitor)
+{
+    return visitor(std::integral_constant<size_t, I>{});
+}
+} // namespace details::switching
+
+// Maps a string to the position of an equal key in `Keys`, choosing the lookup strategy from the key set at compile time:
+// a plain comparison chain for a handful of keys, a length-then-byte decision tree when one byte tells apart all keys of
+// the same length, and a perfect hash otherwise. Every strategy ends with a single full comparison.
+template <basic_fixed_string... Keys>
+struct switch_table
+{
+    static_assert(sizeof...(Keys) > 0, "switch_table requires at least one key");
+
+    using string_view_type = typename details::phf::first<typename decltype(Keys)::string_view_type...>::type;
+    static_assert((std::is_same_v<string_view_type, typename decltype(Keys)::string_view_type> && ...),
+                  "all keys of switch_table must have the same character type and traits");
+
+    using value_type = typename string_view_type::value_type;
+    using traits_type = typename string_view_type::traits_type;
+    using size_type = size_t;
+    static constexpr size_type npos = string_view_type::npos;
+
+  private:
+    static constexpr size_type                               key_count = sizeof...(Keys);
+    static constexpr std::array<string_view_type, key_count> _keys = {string_view_type(Keys)...};
+    static constexpr size_type                               table_count = details::switching::decision_table_count(_keys);
+
+  public:
+    static constexpr string_switch_strategy strategy = key_count <= details::switching::max_linear_keys ? string_switch_strategy::linear
+                                                       : table_count <= details::switching::max_decision_tables
+                                                           ? string_switch_strategy::length_and_byte
+                                                           : string_switch_strategy::perfect_hash;
+
+  private:
+    static constexpr auto make_tree()
+    {
+        if constexpr (strategy == string_switch_strategy::length_and_byte)
+            return details::switching::make_decision_tree<details::switching::max_length(_keys) + 1, table_count>(_keys);
+        else
+            return nullptr;
+    }
+
+    static constexpr auto _tree = make_tree();
+
+    template <size_t... Is>
+    static constexpr auto make_map(std::index_sequence<Is...>)
+    {
+        return static_map<map_entry{Keys, Is}...>{};
+    }
+
+    using map_type = decltype(make_map(std::make_index_sequence<key_count>{}));
+
+    static constexpr bool equal(string_view_type key, string_view_type str) noexcept
+    {
+        return key.size() == str.size() && traits_type::compare(key.data(), str.data(), str.size()) == 0;
+    }
+
+  public:
+    [[nodiscard]] static constexpr size_type        size() noexcept { return key_count; }
+    [[nodiscard]] static constexpr string_view_type key(size_type i) noexcept { return _keys[i]; }
+
+    // Returns the position of `str` in the template argument list or `npos`
+    [[nodiscard]] static constexpr size_type index_of(string_view_type str) noexcept
+    {
+        if constexpr (strategy == string_switch_strategy::linear)
+        {
+            for (size_type i = 0; i < key_count; ++i)
+                if (equal(_keys[i], str))
+                    return i;
+            return npos;
+        }
+        else if constexpr (strategy == string_switch_strategy::length_and_byte)
+        {
+            if (str.size() >= _tree.lengths.size())
+                return npos;
+            const auto entry = _tree.lengths[str.size()];
+            const auto candidate = entry.table == details::switching::none
+                                       ? entry.key
+                                       : _tree.tables[entry.table][details::switching::low_byte(str[entry.position])];
+            if (candidate == details::switching::none || !equal(_keys[candidate], str))
+                return npos;
+            return candidate;
+        }
+        else
+            return map_type::index_of(str);
+    }
+
+    // Calls `visitor(std::integral_constant<size_t, I>{})` for the matching key `I`, or with `npos` as the constant if none matches
+    template <typename TVisitor>
+    static constexpr decltype(auto) visit(string_view_type str, TVisitor&& visitor)
+    {
+        return visit(str, visitor, std::make_index_sequence<key_count>{});
+    }
+
+  private:
+    template <typename TVisitor, size_t... Is>
+    static constexpr decltype(auto) visit(string_view_type str, TVisitor& visitor, std::index_sequence<Is...>)
+    {
+        using result_type = decltype(visitor(std::integral_constant<size_t, npos>{}));
+        constexpr std::array<result_type (*)(TVisitor&), key_count + 1> dispatch = {&details::switching::visit_index<TVisitor, Is>...,
+                                                                                     &details::switching::visit_index<TVisitor, npos>};
+        const auto index = index_of(str);
+        return dispatch[index == npos ? key_count : index](visitor);
+    }
+};
+
+// Returns the position of `str` among `Keys`, or npos
+template <basic_fixed_string... Keys>
+[[nodiscard]] constexpr size_t string_switch(typename switch_table<Keys...>::string_view_type str) noexcept
+{
+    return switch_table<Keys...>::index_of(str);
+}
+
+// Dispatches to `visitor` with the position of `str` among `Keys` as a std::integral_constant, npos if there is no match
+template <basic_fixed_string... Keys, typename TVisitor>
+constexpr decltype(auto) string_switch(typename switch_table<Keys...>::string_view_type str, TVisitor&& visitor)
+{
+    return switch_table<Keys...>::visit(str, visitor);
+}
+
+} // namespace fixstr
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+#endif // FIXSTR_STRING_SWITCH_HPP
@@ -0,0 +1,94 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_TYPE_NAME_HPP
+#define FIXSTR_TYPE_NAME_HPP
+
+#include "../fixed_string.hpp"
+
+#include <string_view>
+
+namespace fixstr
+{
+namespace details::types
+{
+template <typename T>
+constexpr std::string_view signature() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+template <typename T>
+constexpr std::string_view name_of() noexcept
+{
+    std::string_view name = signature<T>();
+#if defined(_MSC_VER) && !defined(__clang__)
+    // "class std::basic_string_view<char,struct std::char_traits<char> > __cdecl fixstr::details::types::signature<T>(void) noexcept"
+    constexpr std::string_view prefix = "signature<";
+    name = name.substr(name.find(prefix) + prefix.size());
+    name = name.substr(0, name.rfind(">("));
+    for (const std::string_view keyword : {"class ", "struct ", "enum ", "union "})
+        if (name.substr(0, keyword.size()) == keyword)
+            name.remove_prefix(keyword.size());
+#else
+    // "... [with T = ns::widget; std::string_view = ...]" (GCC) or "... [T = ns::widget]" (Clang)
+    constexpr std::string_view prefix = "T = ";
+    name = name.substr(name.find(prefix) + prefix.size());
+    const auto end = name.find("; ");
+    name = name.substr(0, end == std::string_view::npos ? name.size() - 1 : end);
+#endif
+    return name;
+}
+} // namespace details::types
+
+// Name of `T` as spelled by the compiler, e.g. "ns::widget<int>", extracted during compilation.
+// The spelling of standard library types and of fundamental types may differ between compilers.
+template <typename T>
+[[nodiscard]] constexpr auto type_name() noexcept
+{
+    constexpr std::string_view             name = details::types::name_of<T>();
+    basic_fixed_string<char, name.size()> result;
+    details::copy(name.begin(), name.end(), result.begin());
+    return result;
+}
+
+template <typename T>
+inline constexpr auto type_name_v = type_name<T>();
+
+template <typename T, typename TAlgorithm = hashing::wyhash>
+[[nodiscard]] constexpr size_t type_hash() noexcept
+{
+    return basic_hash<TAlgorithm>{}(type_name_v<T>);
+}
+
+template <typename T, typename TAlgorithm = hashing::wyhash>
+inline constexpr size_t type_hash_v = type_hash<T, TAlgorithm>();
+
+} // namespace fixstr
+
+#endif // FIXSTR_TYPE_NAME_HPP
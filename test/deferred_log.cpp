@@ -0,0 +1,159 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <cstring>
+#include <cstdint>
+#include <minitest/minitest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fixstr/deferred_log.hpp"
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+using namespace fixstr;
+
+namespace deferred_log_test
+{
+std::vector<std::string> lines(const std::string& text)
+{
+    std::vector<std::string> result;
+    std::istringstream       in(text);
+    for (std::string line; std::getline(in, line);)
+        result.push_back(line);
+    return result;
+}
+} // namespace deferred_log_test
+
+TEST(DeferredLogTest, FormatsOnTheBackgroundThread) {
+    std::ostringstream out;
+    deferred_logger    logger(out);
+    EXPECT_TRUE(logger.log<"px={} qty={}">(101.25, 300u));
+    EXPECT_TRUE(logger.log<"{} {} {}{}">(fixed_string{"XNAS"}, "AAPL", 'B', inplace_string<8>("UY")));
+    EXPECT_TRUE(logger.log<"no arguments {{}}">());
+    logger.flush();
+
+    const auto result = deferred_log_test::lines(out.str());
+    EXPECT_EQ(result.size(), 3u);
+    EXPECT_EQ(result[0], "px=101.25 qty=300");
+    EXPECT_EQ(result[1], "XNAS AAPL BUY");
+    EXPECT_EQ(result[2], "no arguments {}");
+    EXPECT_EQ(logger.dropped(), 0u);
+}
+
+TEST(DeferredLogTest, SameSiteSharesTheMessageId) {
+    std::ostringstream out;
+    {
+        deferred_logger logger(out, 256);
+        for (int i = 0; i < 1000; ++i)
+        {
+            while (!logger.log<"message {}">(i))
+                std::this_thread::yield();
+        }
+    }
+    const auto result = deferred_log_test::lines(out.str());
+    EXPECT_EQ(result.size(), 1000u);
+    EXPECT_EQ(result.front(), "message 0");
+    EXPECT_EQ(result.back(), "message 999");
+}
+
+TEST(DeferredLogTest, EveryThreadKeepsItsOrder) {
+    constexpr int      threads = 4;
+    constexpr int      messages = 2000;
+    std::ostringstream out;
+    {
+        deferred_logger          logger(out, 1024);
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threads; ++t)
+            producers.emplace_back([&logger, t] {
+                for (int i = 0; i < messages; ++i)
+                    while (!logger.log<"{} {}">(t, i))
+                        std::this_thread::yield();
+            });
+        for (auto& producer : producers)
+            producer.join();
+    }
+
+    const auto       result = deferred_log_test::lines(out.str());
+    std::vector<int> next(threads, 0);
+    bool             ordered = true;
+    for (const auto& line : result)
+    {
+        const auto space = line.find(' ');
+        const int  t = std::stoi(line.substr(0, space));
+        ordered = ordered && std::stoi(line.substr(space + 1)) == next[static_cast<size_t>(t)]++;
+    }
+    EXPECT_EQ(result.size(), static_cast<size_t>(threads * messages));
+    EXPECT_TRUE(ordered);
+}
+
+TEST(DeferredLogTest, RingWrapsAroundAndReportsFull) {
+    details::logging::record_ring ring(64);
+    EXPECT_EQ(ring.capacity(), 64u);
+
+    std::vector<std::uint32_t> seen;
+    const auto                 consume = [&] {
+        return ring.consume([&](std::uint16_t id, const std::byte* payload) {
+            std::uint32_t value;
+            std::memcpy(&value, payload, sizeof(value));
+            seen.push_back(id * 1000u + value);
+        });
+    };
+    const auto produce = [&](std::uint16_t id, std::uint32_t value) {
+        std::byte* record = ring.try_reserve(16);
+        if (record == nullptr)
+            return false;
+        const details::logging::record_header header = {id, 0, 16};
+        std::memcpy(record, &header, sizeof(header));
+        std::memcpy(record + sizeof(header), &value, sizeof(value));
+        ring.commit();
+        return true;
+    };
+
+    EXPECT_TRUE(produce(1, 1));
+    EXPECT_TRUE(produce(1, 2));
+    EXPECT_TRUE(produce(1, 3));
+    EXPECT_TRUE(produce(1, 4));
+    EXPECT_FALSE(produce(1, 5));
+    EXPECT_EQ(consume(), 4u);
+
+    // 24-byte records do not divide 64, so the ring has to skip its tail with padding
+    for (std::uint32_t i = 0; i < 10; ++i)
+    {
+        std::byte* record = ring.try_reserve(24);
+        EXPECT_TRUE(record != nullptr);
+        const details::logging::record_header header = {2, 0, 24};
+        std::memcpy(record, &header, sizeof(header));
+        std::memcpy(record + sizeof(header), &i, sizeof(i));
+        ring.commit();
+        EXPECT_EQ(consume(), 1u);
+    }
+    EXPECT_EQ(seen.size(), 14u);
+    EXPECT_EQ(seen[3], 1004u);
+    EXPECT_EQ(seen[13], 2009u);
+}
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
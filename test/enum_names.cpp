@@ -0,0 +1,116 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <cstdint>
+#include <string>
+
+#include "fixstr/enum_names.hpp"
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+using namespace fixstr;
+
+namespace enum_names_test
+{
+enum class side : std::uint8_t
+{
+    buy,
+    sell,
+    short_sell
+};
+
+enum class status : int
+{
+    rejected = -1,
+    pending_new = 0,
+    filled = 2,
+    canceled = 4,
+    expired = 120
+};
+
+enum flags : unsigned
+{
+    none = 0,
+    read = 1,
+    write = 2,
+    execute = 4
+};
+
+enum class opcode : std::uint16_t
+{
+    nop = 1,
+    jump = 300
+};
+} // namespace enum_names_test
+
+template <>
+struct fixstr::enum_range<enum_names_test::opcode>
+{
+    static constexpr long long min = 0;
+    static constexpr long long max = 512;
+};
+
+TEST(EnumNamesTest, ReflectsEnumeratorNames) {
+    using namespace enum_names_test;
+    static_assert(enum_names<side>::size() == 3);
+    static_assert(enum_to_string(side::short_sell) == "short_sell");
+    static_assert(enum_from_string<side>("sell") == side::sell);
+    static_assert(!enum_from_string<side>("Sell"));
+    static_assert(enum_to_string(static_cast<side>(7)).empty());
+
+    using status_names = enum_names<status>;
+    EXPECT_EQ(status_names::size(), 5u);
+    EXPECT_TRUE(status_names::value(0) == status::rejected);
+    for (size_t i = 0; i < status_names::size(); ++i)
+    {
+        const std::string name(status_names::name(i));
+        EXPECT_TRUE(status_names::from_string(name) == status_names::value(i));
+        EXPECT_EQ(status_names::to_string(status_names::value(i)), name);
+        EXPECT_EQ(status_names::name(i).data()[name.size()], '\0');
+    }
+    EXPECT_TRUE(status_names::to_string(static_cast<status>(1)).empty());
+    EXPECT_TRUE(status_names::to_string(static_cast<status>(1000)).empty());
+    EXPECT_FALSE(status_names::from_string("partially_filled"));
+
+    EXPECT_EQ(enum_to_string(execute), "execute");
+    EXPECT_TRUE(enum_from_string<flags>("none") == none);
+}
+
+TEST(EnumNamesTest, CustomRange) {
+    using namespace enum_names_test;
+    static_assert(enum_to_string(opcode::jump) == "jump");
+    static_assert(enum_from_string<opcode>("nop") == opcode::nop);
+}
+
+TEST(EnumNamesTest, DeclaredNames) {
+    using namespace enum_names_test;
+    using wire = enum_names<side, "BUY", "SELL", "SELL_SHORT">;
+    static_assert(wire::to_string(side::short_sell) == "SELL_SHORT");
+    static_assert(wire::from_string("BUY") == side::buy);
+    EXPECT_FALSE(wire::from_string("buy"));
+    EXPECT_TRUE(wire::to_string(static_cast<side>(3)).empty());
+}
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
@@ -0,0 +1,134 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <string>
+#include <vector>
+
+#include "fixstr/fixed_string_array.hpp"
+#include "utils.hpp"
+
+using namespace fixstr;
+
+namespace utils
+{
+// Compares every batch operation with a scalar loop over the same elements
+template <size_t N, typename TLayout>
+bool matches_scalar(size_t count)
+{
+    const auto                          symbols = random_keys<fixed_string<N>>(count, "ABC", 12345);
+    const fixed_string_array<N, TLayout> array(symbols.begin(), symbols.end());
+    if (array.size() != count)
+        return false;
+
+    const fixed_string<N> wanted = symbols.empty() ? fixed_string<N>() : symbols[count / 2];
+    const std::string     prefix(std::string_view(wanted).substr(0, N / 2 + 1));
+    const auto            equal = array.find_equal(wanted);
+    const auto            with_prefix = array.filter_prefix(prefix);
+    const auto            with_c = array.filter_contains('C');
+    size_t                equal_count = 0;
+    size_t                prefix_count = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const std::string_view symbol = symbols[i];
+        if (array[i] != symbols[i])
+            return false;
+        if (equal.test(i) != (symbols[i] == wanted))
+            return false;
+        if (with_prefix.test(i) != (symbol.substr(0, prefix.size()) == prefix))
+            return false;
+        if (with_c.test(i) != (symbol.find('C') != std::string_view::npos))
+            return false;
+        equal_count += equal.test(i);
+        prefix_count += with_prefix.test(i);
+    }
+    return array.count_equal(wanted) == equal_count && array.count_prefix(prefix) == prefix_count;
+}
+} // namespace utils
+
+TEST(FixedStringArrayTest, BatchOperationsMatchScalarLoops) {
+    for (const size_t count : {size_t(0), size_t(1), size_t(31), size_t(32), size_t(33), size_t(64), size_t(65), size_t(1000)})
+    {
+        EXPECT_TRUE((utils::matches_scalar<1, row_layout>(count)));
+        EXPECT_TRUE((utils::matches_scalar<3, row_layout>(count)));
+        EXPECT_TRUE((utils::matches_scalar<12, row_layout>(count)));
+        EXPECT_TRUE((utils::matches_scalar<16, row_layout>(count)));
+        EXPECT_TRUE((utils::matches_scalar<21, row_layout>(count)));
+        EXPECT_TRUE((utils::matches_scalar<3, column_layout>(count)));
+        EXPECT_TRUE((utils::matches_scalar<12, column_layout>(count)));
+        EXPECT_TRUE((utils::matches_scalar<21, column_layout>(count)));
+    }
+}
+
+TEST(FixedStringArrayTest, ElementAccess) {
+    fixed_string_array<4> rows = {fixed_string<4>("AAPL"), fixed_string<4>("MSFT")};
+    rows.push_back(fixed_string<4>("IBM "));
+    rows.push_back(std::string_view("INTC"));
+    EXPECT_EQ(rows.size(), 4u);
+    EXPECT_EQ(rows[1], fixed_string<4>("MSFT"));
+    EXPECT_EQ(rows.back(), fixed_string<4>("INTC"));
+    EXPECT_EQ(std::string_view(rows.data(), 16), std::string_view("AAPLMSFTIBM INTC"));
+    static_assert(std::is_same_v<decltype(rows[0]), fixed_string_view<4>>);
+    EXPECT_TRUE(utils::throws<std::out_of_range>([&] { (void)rows.at(4); }));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { rows.push_back(std::string_view("IBM")); }));
+
+    fixed_string_array<4, column_layout> columns(rows.begin(), rows.end());
+    static_assert(std::is_same_v<decltype(columns[0]), fixed_string<4>>);
+    EXPECT_EQ(columns[2], fixed_string<4>("IBM "));
+    columns.pop_back();
+    EXPECT_EQ(columns.size(), 3u);
+    EXPECT_EQ(columns.back(), fixed_string<4>("IBM "));
+
+    std::string joined;
+    for (const auto symbol : columns)
+        joined += std::string_view(symbol);
+    EXPECT_EQ(joined, "AAPLMSFTIBM ");
+
+    rows.clear();
+    EXPECT_TRUE(rows.empty());
+    EXPECT_EQ(rows.find_equal(fixed_string<4>("AAPL")).find_first(), match_mask::npos);
+}
+
+TEST(FixedStringArrayTest, MatchMask) {
+    fixed_string_array<2, column_layout> array;
+    for (size_t i = 0; i < 200; ++i)
+        array.push_back(i % 3 == 0 ? fixed_string<2>("ab") : fixed_string<2>("cd"));
+
+    const auto mask = array.find_equal(fixed_string<2>("ab"));
+    EXPECT_EQ(mask.size(), 200u);
+    EXPECT_EQ(mask.count(), 67u);
+    EXPECT_EQ(mask.find_first(), 0u);
+    EXPECT_EQ(mask.find_next(1), 3u);
+    EXPECT_EQ(mask.find_next(64), 66u);
+    EXPECT_EQ(mask.find_next(199), match_mask::npos);
+
+    size_t visited = 0;
+    bool   ordered = true;
+    mask.for_each([&](size_t index) { ordered &= index == visited++ * 3; });
+    EXPECT_EQ(visited, 67u);
+    EXPECT_TRUE(ordered);
+
+    EXPECT_EQ(array.count_prefix("abc"), 0u);
+    EXPECT_EQ(array.count_prefix(""), 200u);
+}
@@ -0,0 +1,160 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "fixstr/flat_map.hpp"
+#include "utils.hpp"
+
+using namespace fixstr;
+
+namespace utils
+{
+
+// A hash that sends every key into the same group so that probing, tombstones and rehashing in place are exercised
+struct colliding_hash
+{
+    template <typename T>
+    size_t operator()(const T& key) const noexcept
+    {
+        return static_cast<size_t>(key[0] & 0x7f);
+    }
+};
+} // namespace utils
+
+TEST(FlatMapTest, InsertFindErase) {
+    flat_map<4, int> map = {{fixed_string<4>("AAPL"), 1}, {fixed_string<4>("MSFT"), 2}};
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at("AAPL"), 1);
+    EXPECT_EQ(map.at(fixed_string<4>("MSFT")), 2);
+    EXPECT_TRUE(map.find(std::string_view("MSF")) == map.end());
+    EXPECT_TRUE(map.find(std::string("IBM ")) == map.end());
+    EXPECT_FALSE(map.contains("AAPLX"));
+    EXPECT_TRUE(utils::throws<std::out_of_range>([&] { (void)map.at("IBM "); }));
+
+    EXPECT_FALSE(map.try_emplace("AAPL", 10).second);
+    EXPECT_EQ(map.at("AAPL"), 1);
+    EXPECT_FALSE(map.insert_or_assign("AAPL", 10).second);
+    EXPECT_EQ(map.at("AAPL"), 10);
+    map["IBM "] += 3;
+    EXPECT_EQ(map.at("IBM "), 3);
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { map["IBM"] = 1; }));
+
+    EXPECT_EQ(map.erase("MSFT"), 1u);
+    EXPECT_EQ(map.erase("MSFT"), 0u);
+    EXPECT_EQ(map.erase("MS"), 0u);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.count("MSFT"), 0u);
+
+    int sum = 0;
+    for (const auto& [key, value] : map)
+        sum += value + (key == fixed_string<4>("IBM ") ? 100 : 0);
+    EXPECT_EQ(sum, 113);
+}
+
+TEST(FlatMapTest, MatchesStdMapUnderChurn) {
+    flat_map<8, std::string>               map;
+    std::map<std::string, std::string>      reference;
+    utils::lcg                             random(7);
+    for (int step = 0; step < 20000; ++step)
+    {
+        const auto key = utils::make_key<8>(random() % 3000);
+        if (random() % 3 == 0)
+            EXPECT_EQ(map.erase(key), reference.erase(std::string(key)));
+        else
+        {
+            map[key] = std::to_string(step);
+            reference[std::string(key)] = std::to_string(step);
+        }
+    }
+    EXPECT_EQ(map.size(), reference.size());
+    size_t visited = 0;
+    for (const auto& [key, value] : map)
+    {
+        ++visited;
+        EXPECT_EQ(reference.at(std::string(key)), value);
+    }
+    EXPECT_EQ(visited, reference.size());
+
+    const auto copy = map;
+    for (const auto& [key, value] : reference)
+        EXPECT_EQ(copy.at(key), value);
+
+    for (auto it = map.begin(); it != map.end();)
+        it = it->first[0] == 'A' ? map.erase(it) : ++it;
+    for (const auto& [key, value] : reference)
+        EXPECT_EQ(map.contains(key), key[0] != 'A');
+}
+
+TEST(FlatMapTest, CollidingHashes) {
+    flat_map<8, int, utils::colliding_hash> map;
+    for (std::uint32_t round = 0; round < 50; ++round)
+    {
+        for (std::uint32_t i = 0; i < 100; ++i)
+            map[utils::make_key<8>(i)] = static_cast<int>(round);
+        for (std::uint32_t i = 0; i < 100; i += 2)
+            map.erase(utils::make_key<8>(i));
+    }
+    EXPECT_EQ(map.size(), 50u);
+    EXPECT_TRUE(map.capacity() <= 256u);
+    for (std::uint32_t i = 0; i < 100; ++i)
+        EXPECT_EQ(map.contains(utils::make_key<8>(i)), i % 2 == 1);
+}
+
+TEST(FlatMapTest, ReserveAndMove) {
+    flat_map<8, std::vector<int>> map;
+    map.reserve(1000);
+    const auto capacity = map.capacity();
+    EXPECT_TRUE(capacity / 8 * 7 >= 1000u);
+    for (std::uint32_t i = 0; i < 1000; ++i)
+        map.try_emplace(utils::make_key<8>(i), 3, static_cast<int>(i));
+    EXPECT_EQ(map.capacity(), capacity);
+
+    auto moved = std::move(map);
+    EXPECT_EQ(moved.size(), 1000u);
+    EXPECT_EQ(moved.at(utils::make_key<8>(999)).size(), 3u);
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_FALSE(moved.contains(utils::make_key<8>(1)));
+}
+
+TEST(FlatSetTest, Basics) {
+    flat_set<3> set = {fixed_string<3>("NEW"), fixed_string<3>("ACK")};
+    EXPECT_TRUE(set.insert("FIL").second);
+    EXPECT_FALSE(set.insert(fixed_string<3>("NEW")).second);
+    EXPECT_TRUE(set.contains("ACK"));
+    EXPECT_TRUE(set.contains(std::string_view("FIL")));
+    EXPECT_FALSE(set.contains("FILL"));
+    EXPECT_EQ(set.erase("ACK"), 1u);
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { set.insert("X"); }));
+
+    std::string joined;
+    for (const auto& key : set)
+        joined += std::string_view(key);
+    EXPECT_TRUE(joined == "NEWFIL" || joined == "FILNEW");
+}
@@ -0,0 +1,237 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <minitest/minitest.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "fixstr/format.hpp"
+
+using namespace fixstr;
+
+namespace format_test
+{
+// Digits and sign of an integer
+template <typename T>
+constexpr std::size_t decimal_length(T value)
+{
+    std::size_t length = 1;
+    if constexpr (std::is_signed_v<T>)
+        length += value < 0;
+    while (value /= 10)
+        ++length;
+    return length;
+}
+
+template <auto Value>
+bool matches_to_string()
+{
+    constexpr auto str = to_fixed_string<Value>();
+    static_assert(str.size() == decimal_length(Value));
+    return std::string_view(str) == std::to_string(Value);
+}
+
+template <typename T, T... Values>
+bool all_match_to_string(std::integer_sequence<T, Values...>)
+{
+    return (matches_to_string<Values>() && ...);
+}
+
+template <typename T, size_t... Is>
+bool powers_match_to_string(std::index_sequence<Is...>)
+{
+    constexpr auto power = [](size_t exponent) {
+        T result = 1;
+        for (size_t i = 0; i < exponent; ++i)
+            result = static_cast<T>(result * 10);
+        return result;
+    };
+    return (matches_to_string<power(Is)>() && ...) && (matches_to_string<static_cast<T>(power(Is) - 1)>() && ...);
+}
+
+#if FIXSTR_FLOATING_POINT_NTTP_PRESENT
+template <auto Value>
+bool matches_to_chars()
+{
+    char       buffer[512];
+    const auto end = std::to_chars(buffer, buffer + sizeof(buffer), Value, std::chars_format::fixed).ptr;
+    return std::string_view(to_fixed_string<Value>()) == std::string_view(buffer, static_cast<size_t>(end - buffer));
+}
+
+template <size_t... Is>
+bool floating_point_matches_to_chars(std::index_sequence<Is...>)
+{
+    return (matches_to_chars<static_cast<double>(Is) * 0.37 - 21.5>() && ...) && (matches_to_chars<static_cast<float>(Is) / 7.0f>() && ...);
+}
+#endif // FIXSTR_FLOATING_POINT_NTTP_PRESENT
+} // namespace format_test
+
+TEST(FormatTest, IntegersHaveExactLength) {
+    static_assert(to_fixed_string<0>() == fixed_string{"0"});
+    static_assert(to_fixed_string<42>() == fixed_string{"42"});
+    static_assert(to_fixed_string<-17>() == fixed_string{"-17"});
+    static_assert(std::is_same_v<decltype(to_fixed_string<12345u>()), basic_fixed_string<char, 5>>);
+    static_assert(to_fixed_string<std::numeric_limits<std::int64_t>::min()>() == fixed_string{"-9223372036854775808"});
+    static_assert(to_fixed_string<std::numeric_limits<std::uint64_t>::max()>() == fixed_string{"18446744073709551615"});
+    static_assert(to_fixed_string<true>() == fixed_string{"true"});
+    static_assert(to_fixed_string<false>() == fixed_string{"false"});
+    static_assert(to_fixed_string<-5, wchar_t>() == fixed_wstring{L"-5"});
+}
+
+TEST(FormatTest, IntegersMatchToString) {
+    EXPECT_TRUE(format_test::all_match_to_string(std::make_integer_sequence<int, 200>{}));
+    EXPECT_TRUE(format_test::powers_match_to_string<std::int64_t>(std::make_index_sequence<19>{}));
+    EXPECT_TRUE(format_test::powers_match_to_string<std::uint64_t>(std::make_index_sequence<20>{}));
+    EXPECT_TRUE(format_test::matches_to_string<std::numeric_limits<short>::min()>());
+    EXPECT_TRUE(format_test::matches_to_string<std::numeric_limits<unsigned char>::max()>());
+}
+
+#if FIXSTR_FLOATING_POINT_NTTP_PRESENT
+TEST(FormatTest, FloatingPointUsesShortestFixedNotation) {
+    static_assert(to_fixed_string<3.5>() == fixed_string{"3.5"});
+    static_assert(to_fixed_string<0.1>() == fixed_string{"0.1"});
+    static_assert(to_fixed_string<0.1f>() == fixed_string{"0.1"});
+    static_assert(to_fixed_string<2.0>() == fixed_string{"2"});
+    static_assert(to_fixed_string<-0.0>() == fixed_string{"-0"});
+    static_assert(to_fixed_string<0.000123>() == fixed_string{"0.000123"});
+    static_assert(to_fixed_string<1e17>() == fixed_string{"100000000000000000"});
+    EXPECT_TRUE(format_test::floating_point_matches_to_chars(std::make_index_sequence<150>{}));
+    EXPECT_TRUE(format_test::matches_to_chars<std::numeric_limits<double>::denorm_min()>());
+    EXPECT_TRUE(format_test::matches_to_chars<std::numeric_limits<double>::max()>());
+    EXPECT_TRUE(format_test::matches_to_chars<std::numeric_limits<double>::min()>());
+    EXPECT_TRUE(format_test::matches_to_chars<std::numeric_limits<float>::max()>());
+    EXPECT_TRUE(format_test::matches_to_chars<std::numeric_limits<float>::denorm_min()>());
+    EXPECT_TRUE(format_test::matches_to_chars<1e23>());
+    EXPECT_TRUE(format_test::matches_to_chars<9007199254740993.0>());
+}
+#endif // FIXSTR_FLOATING_POINT_NTTP_PRESENT
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+TEST(FormatTest, FormatWithConstants) {
+    constexpr auto metric = format<"{}.shard{}.{}", fixed_string{"svc"}, 17, fixed_string{"latency"}>();
+    static_assert(std::is_same_v<decltype(metric), const basic_fixed_string<char, 19>>);
+    static_assert(metric == fixed_string{"svc.shard17.latency"});
+    static_assert(format<"plain">() == fixed_string{"plain"});
+    static_assert(format<"{{{}}}", 'x'>() == fixed_string{"{x}"});
+    static_assert(format<"{}{}", -1, 2u>() == fixed_string{"-12"});
+    static_assert(format<L"id={}", 7>() == fixed_wstring{L"id=7"});
+    EXPECT_EQ(std::string_view(metric), "svc.shard17.latency");
+}
+
+TEST(FormatTest, FormatWithStringArguments) {
+    const fixed_string service = "svc";
+    const auto         label = format<"{}/{}:{}">(service, "port", '8');
+    static_assert(std::is_same_v<decltype(label), const basic_fixed_string<char, 10>>);
+    EXPECT_EQ(std::string_view(label), "svc/port:8");
+    static_assert(format<"[{}]">(fixed_string{"a"}) == fixed_string{"[a]"});
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+namespace format_test
+{
+template <typename T>
+std::string to_chars_string(T value)
+{
+    char       buffer[64];
+    const auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+    return std::string(buffer, end);
+}
+} // namespace format_test
+
+TEST(FormatTest, FormatToBuffer) {
+    constexpr size_t max_size = max_formatted_size_v<"order {} filled {}@{}", std::uint64_t, int, double>;
+    static_assert(max_size == 15 + 20 + 11 + 24);
+
+    char       buffer[max_size];
+    const auto end = format_to<"order {} filled {}@{}">(buffer, std::uint64_t(18446744073709551615ULL), -2147483647 - 1, -2.2250738585072014e-308);
+    EXPECT_EQ(std::string_view(buffer, static_cast<size_t>(end - buffer)), "order 18446744073709551615 filled -2147483648@-2.2250738585072014e-308");
+    EXPECT_EQ(static_cast<size_t>(end - buffer), max_size);
+
+    const auto escaped_end = format_to<"{{{}}}">(buffer, 7);
+    EXPECT_EQ(std::string_view(buffer, static_cast<size_t>(escaped_end - buffer)), "{7}");
+}
+
+TEST(FormatTest, FormatArgumentsMatchToChars) {
+    const double  doubles[] = {0.0, -0.0, 0.1, 3.5, 1e23, 123456.789, 5e-324, 1.7976931348623157e308, -17.060000000000002};
+    const float   floats[] = {0.1f, 3.4028235e38f, 1e-45f, -7.25f};
+    const long    integers[] = {0, 1, -1, 42, std::numeric_limits<long>::min(), std::numeric_limits<long>::max()};
+    for (const auto value : doubles)
+        EXPECT_EQ(std::string_view(format_inplace<"{}">(value)), format_test::to_chars_string(value));
+    for (const auto value : floats)
+        EXPECT_EQ(std::string_view(format_inplace<"{}">(value)), format_test::to_chars_string(value));
+    for (const auto value : integers)
+        EXPECT_EQ(std::string_view(format_inplace<"{}">(value)), std::to_string(value));
+}
+
+TEST(FormatTest, FormatInplaceString) {
+    const inplace_string<8> side = "BUY";
+    const auto              line = format_inplace<"{} {} {}:{} {}">(side, fixed_string{"XNAS"}, "AAPL", 'Q', false);
+    static_assert(decltype(line)::capacity() == 8 + 4 + 4 + 1 + 5 + 4);
+    EXPECT_EQ(std::string_view(line), "BUY XNAS AAPL:Q false");
+
+    inplace_string<24> log = "id=";
+    format_to<"{},qty={}">(log, 17u, static_cast<short>(-3));
+    EXPECT_EQ(std::string_view(log), "id=17,qty=-3");
+    EXPECT_EQ(log.c_str()[log.size()], '\0');
+
+    bool thrown = false;
+    try
+    {
+        format_to<"{}">(log, std::uint64_t(1));
+    }
+    catch (const std::length_error&)
+    {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_EQ(std::string_view(log), "id=17,qty=-3");
+
+    const auto wide = format_inplace<L"{}-{}">(42, L'z');
+    EXPECT_TRUE(wide == std::wstring_view(L"42-z"));
+}
+
+TEST(FormatTest, ArgumentsMustMatchFormatCharType) {
+    using details::formatting::has_format_char_type_v;
+    static_assert(has_format_char_type_v<wchar_t, wchar_t>);
+    static_assert(has_format_char_type_v<wchar_t, int>);
+    static_assert(has_format_char_type_v<wchar_t, bool>);
+    static_assert(has_format_char_type_v<wchar_t, double>);
+    static_assert(has_format_char_type_v<wchar_t, fixed_wstring<3>>);
+    static_assert(has_format_char_type_v<wchar_t, wchar_t[4]>);
+    static_assert(has_format_char_type_v<wchar_t, inplace_wstring<8>>);
+    static_assert(!has_format_char_type_v<wchar_t, char>);
+    static_assert(!has_format_char_type_v<char, char16_t>);
+    static_assert(!has_format_char_type_v<wchar_t, fixed_string<3>>);
+    static_assert(!has_format_char_type_v<wchar_t, char[4]>);
+    static_assert(!has_format_char_type_v<wchar_t, inplace_string<8>>);
+    static_assert(!has_format_char_type_v<char, inplace_u32string<8>>);
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
@@ -0,0 +1,44 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+// Each case must be rejected at compile time: see make_compile_failure_test in CMakeLists.txt
+
+#include "fixstr/format.hpp"
+
+using namespace fixstr;
+
+void format_mismatch()
+{
+    wchar_t buffer[16];
+#if defined(FIXSTR_FORMAT_MISMATCH_CHARACTER)
+    format_to<L"[{}]">(buffer, 'A');
+#elif defined(FIXSTR_FORMAT_MISMATCH_FIXED_STRING)
+    format_to<L"<{}>">(buffer, fixed_string("abc"));
+#elif defined(FIXSTR_FORMAT_MISMATCH_INPLACE_STRING)
+    format_to<L"<{}>">(buffer, inplace_string<8>("abc"));
+#else
+    format_to<L"<{}>">(buffer, 1);
+#endif
+}
@@ -0,0 +1,201 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+
+#include "fixstr/inplace_string.hpp"
+#include "utils.hpp"
+
+using namespace fixstr;
+
+TEST(InplaceStringTest, DefaultConstructionIsEmpty) {
+    inplace_string<15> str;
+    EXPECT_TRUE(str.empty());
+    EXPECT_EQ(str.size(), 0u);
+    EXPECT_EQ(str.capacity(), 15u);
+    EXPECT_EQ(*str.c_str(), '\0');
+    static_assert(sizeof(inplace_string<15>) == 17);
+}
+
+TEST(InplaceStringTest, ConstructionFromLiteralFixedStringAndStringView) {
+    constexpr inplace_string<8> from_literal = "abc";
+    static_assert(from_literal.size() == 3);
+    static_assert(from_literal == "abc");
+
+    constexpr fixed_string<4> fixed = "abcd";
+    constexpr inplace_string<8> from_fixed = fixed;
+    static_assert(from_fixed == fixed);
+
+    const std::string runtime = "runtime";
+    inplace_string<8> from_view(std::string_view{runtime});
+    EXPECT_EQ(from_view, std::string_view("runtime"));
+    EXPECT_EQ(std::string(from_view.c_str()), runtime);
+
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { inplace_string<4> too_long(std::string_view{runtime}); }));
+    EXPECT_EQ(inplace_string<4>::truncate(runtime), std::string_view("runt"));
+
+    inplace_string<4> target = "ab";
+    EXPECT_FALSE(target.try_assign(runtime));
+    EXPECT_EQ(target, std::string_view("ab"));
+    EXPECT_TRUE(target.try_assign("xyz"));
+    EXPECT_EQ(target, std::string_view("xyz"));
+}
+
+TEST(InplaceStringTest, PushBackAndAppend) {
+    inplace_string<6> str;
+    str.push_back('a');
+    str += 'b';
+    str.append("cd");
+    str.append(1, 'e');
+    EXPECT_EQ(str, std::string_view("abcde"));
+    EXPECT_TRUE(str.try_push_back('f'));
+    EXPECT_TRUE(str.full());
+    EXPECT_FALSE(str.try_push_back('g'));
+    EXPECT_FALSE(str.try_append("g"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { str.push_back('g'); }));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { str.append("gh"); }));
+    EXPECT_EQ(str, std::string_view("abcdef"));
+    str.pop_back();
+    EXPECT_EQ(str, std::string_view("abcde"));
+    EXPECT_EQ(str.data()[5], '\0');
+}
+
+TEST(InplaceStringTest, InsertEraseResize) {
+    inplace_string<16> str = "hello world";
+    str.insert(5, ",");
+    EXPECT_EQ(str, std::string_view("hello, world"));
+    str.insert(0, 2, '>');
+    EXPECT_EQ(str, std::string_view(">>hello, world"));
+    str.insert(str.size(), str.substr(0, 2));
+    EXPECT_EQ(str, std::string_view(">>hello, world>>"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { str.insert(0, "x"); }));
+    EXPECT_TRUE(utils::throws<std::out_of_range>([&] { str.erase(17); }));
+
+    str.erase(0, 2);
+    str.erase(str.size() - 2);
+    EXPECT_EQ(str, std::string_view("hello, world"));
+    str.erase(5, 1);
+    EXPECT_EQ(str, std::string_view("hello world"));
+
+    str.resize(5);
+    EXPECT_EQ(str, std::string_view("hello"));
+    str.resize(8, '!');
+    EXPECT_EQ(str, std::string_view("hello!!!"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { str.resize(17); }));
+
+    // every character past the size is zeroed
+    for (std::size_t i = str.size(); i <= str.capacity(); ++i)
+        EXPECT_EQ(str._data[i], '\0');
+
+    constexpr auto compile_time = [] {
+        inplace_string<8> s = "ace";
+        s.insert(1, "b");
+        s.insert(3, 1, 'd');
+        s.erase(0, 1);
+        return s;
+    }();
+    static_assert(compile_time == "bcde");
+}
+
+TEST(InplaceStringTest, ResizeAndOverwrite) {
+    inplace_string<8> str = "abcdef";
+    str.resize_and_overwrite(8, [](char* data, std::size_t count) {
+        EXPECT_EQ(count, 8u);
+        data[6] = 'g';
+        data[7] = 'h';
+        return std::size_t(2);
+    });
+    EXPECT_EQ(str, std::string_view("ab"));
+    for (std::size_t i = str.size(); i <= str.capacity(); ++i)
+        EXPECT_EQ(str._data[i], '\0');
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { str.resize_and_overwrite(9, [](char*, std::size_t) { return std::size_t(0); }); }));
+
+    constexpr auto compile_time = [] {
+        inplace_string<4> s;
+        s.resize_and_overwrite(3, [](char* data, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i)
+                data[i] = static_cast<char>('x' + i);
+            return count;
+        });
+        return s;
+    }();
+    static_assert(compile_time == "xyz");
+}
+
+TEST(InplaceStringTest, Comparisons) {
+    const inplace_string<8>  a = "abc";
+    const inplace_string<16> b = "abd";
+    const fixed_string<3>    fixed = "abc";
+
+    EXPECT_TRUE(a == fixed);
+    EXPECT_TRUE(fixed == a);
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(b > fixed);
+    EXPECT_TRUE(fixed <= a);
+    EXPECT_TRUE(a == std::string_view("abc"));
+    EXPECT_TRUE(std::string_view("abc") == a);
+    EXPECT_TRUE(a == "abc");
+    EXPECT_TRUE("abd" == b);
+    EXPECT_TRUE(a == std::string("abc"));
+    EXPECT_FALSE(a == "ab");
+}
+
+TEST(InplaceStringTest, ConcatenationAndConversions) {
+    const inplace_string<4> a = "ab";
+    const fixed_string<2>   fixed = "cd";
+
+    const auto sum = a + fixed + '!' + "?" + a;
+    static_assert(decltype(sum)::capacity() == 4 + 2 + 1 + 1 + 4);
+    EXPECT_EQ(sum, std::string_view("abcd!?ab"));
+    EXPECT_EQ(fixed + a, std::string_view("cdab"));
+    EXPECT_EQ('>' + a, std::string_view(">ab"));
+
+    const auto as_fixed = static_cast<basic_fixed_string<char, 2>>(a);
+    EXPECT_TRUE(as_fixed == std::string_view("ab"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { (void)static_cast<basic_fixed_string<char, 3>>(a); }));
+}
+
+TEST(InplaceStringTest, StreamAndHash) {
+    const inplace_string<8> str = "abc";
+    std::ostringstream      out;
+    out << str;
+    EXPECT_EQ(out.str(), "abc");
+
+    EXPECT_EQ(std::hash<inplace_string<8>>()(str), fixstr::hash()(fixed_string<3>("abc")));
+    std::unordered_set<inplace_string<8>> set = {str, inplace_string<8>("abd")};
+    EXPECT_EQ(set.count(inplace_string<8>("abc")), 1u);
+}
+
+TEST(InplaceStringTest, WideCharacters) {
+    inplace_u16string<8> str = u"ab";
+    str.append(u"cd");
+    EXPECT_EQ(str, std::u16string_view(u"abcd"));
+    EXPECT_EQ(str.find(u'c'), 2u);
+    EXPECT_TRUE(str.starts_with(u"ab"));
+    EXPECT_TRUE(str.ends_with(u'd'));
+}
@@ -0,0 +1,129 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fixstr/intern_pool.hpp"
+#include "utils.hpp"
+
+using namespace fixstr;
+
+TEST(InternPoolTest, DenseIdsAndReverseLookup) {
+    intern_pool<8> pool(100);
+    EXPECT_EQ(pool.capacity(), 100u);
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(pool.find("AAPL"), intern_pool<8>::npos);
+
+    EXPECT_EQ(pool.intern("AAPL"), 0u);
+    EXPECT_EQ(pool.intern("MSFT"), 1u);
+    EXPECT_EQ(pool.intern("AAPL"), 0u);
+    EXPECT_EQ(pool.intern(fixed_string<4>("GOOG")), 2u);
+    EXPECT_EQ(pool.intern(""), 3u);
+    EXPECT_EQ(pool.intern("12345678"), 4u);
+    EXPECT_EQ(pool.size(), 5u);
+
+    EXPECT_EQ(pool.find("MSFT"), 1u);
+    EXPECT_EQ(pool.find(fixed_string<4>("GOOG")), 2u);
+    EXPECT_EQ(pool.find(""), 3u);
+    EXPECT_TRUE(pool.contains("12345678"));
+    EXPECT_FALSE(pool.contains("AAP"));
+    EXPECT_FALSE(pool.contains("123456789"));
+
+    EXPECT_EQ(pool[0], std::string_view("AAPL"));
+    EXPECT_EQ(pool.at(2), std::string_view("GOOG"));
+    EXPECT_EQ(pool.at(3), std::string_view(""));
+    EXPECT_EQ(pool.at(4), std::string_view("12345678"));
+    EXPECT_TRUE(utils::throws<std::out_of_range>([&] { (void)pool.at(5); }));
+}
+
+TEST(InternPoolTest, PaddingDoesNotMatchZeros) {
+    intern_pool<4> pool(4);
+    const std::string with_zero("a\0", 2);
+    EXPECT_EQ(pool.intern("a"), 0u);
+    EXPECT_EQ(pool.intern(with_zero), 1u);
+    EXPECT_EQ(pool.find("a"), 0u);
+    EXPECT_EQ(pool.find(with_zero), 1u);
+    EXPECT_EQ(pool[1], std::string_view(with_zero));
+}
+
+TEST(InternPoolTest, Limits) {
+    intern_pool<4> pool(3);
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { pool.intern("12345"); }));
+    pool.intern("a");
+    pool.intern("b");
+    pool.intern("c");
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { pool.intern("d"); }));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { pool.intern("e"); }));
+    EXPECT_EQ(pool.size(), 3u);
+    EXPECT_EQ(pool.intern("b"), 1u);
+    EXPECT_FALSE(pool.contains("d"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { intern_pool<4> too_large(intern_pool<4>::max_capacity + 1); }));
+}
+
+TEST(InternPoolTest, ConcurrentInterning) {
+    constexpr std::size_t    count = 3000;
+    constexpr unsigned       threads = 4;
+    std::vector<std::string> strings;
+    for (std::size_t i = 0; i < count; ++i)
+        strings.push_back("s" + std::to_string(i * 7919 % 100003));
+
+    intern_pool<12>                         pool(count);
+    std::vector<std::vector<std::uint32_t>> ids(threads, std::vector<std::uint32_t>(count));
+    std::vector<std::thread>                workers;
+    for (unsigned t = 0; t < threads; ++t)
+        workers.emplace_back([&, t] {
+            std::vector<std::size_t> order(count);
+            for (std::size_t i = 0; i < count; ++i)
+                order[i] = i;
+            std::shuffle(order.begin(), order.end(), std::mt19937(t));
+            for (const auto i : order)
+            {
+                ids[t][i] = pool.intern(strings[i]);
+                if (pool.find(strings[i]) != ids[t][i])
+                    ids[t][i] = intern_pool<12>::npos;
+            }
+        });
+    for (auto& worker : workers)
+        worker.join();
+
+    EXPECT_EQ(pool.size(), count);
+    std::vector<bool> seen(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        for (unsigned t = 1; t < threads; ++t)
+            EXPECT_EQ(ids[t][i], ids[0][i]);
+        EXPECT_TRUE(ids[0][i] < count);
+        if (ids[0][i] < count)
+        {
+            EXPECT_FALSE(seen[ids[0][i]]);
+            seen[ids[0][i]] = true;
+            EXPECT_EQ(pool[ids[0][i]], std::string_view(strings[i]));
+        }
+    }
+}
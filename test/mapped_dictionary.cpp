@@ -0,0 +1,158 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "fixstr/mapped_dictionary.hpp"
+#include "utils.hpp"
+
+using namespace fixstr;
+
+namespace utils
+{
+// Keys over four letters, with many duplicates
+std::vector<fixed_string<6>> make_keys(size_t count)
+{
+    return random_keys<fixed_string<6>>(count, "ABCD", 5);
+}
+
+std::string serialize(const std::vector<fixed_string<6>>& keys, dictionary_index index)
+{
+    std::ostringstream out;
+    mapped_dictionary<6>::write(out, keys.begin(), keys.end(), index);
+    return out.str();
+}
+} // namespace utils
+
+TEST(MappedDictionaryTest, LookupsMatchSortedKeys) {
+    auto keys = utils::make_keys(3000);
+    for (const auto index : {dictionary_index::none, dictionary_index::hash})
+    {
+        const std::string          file = utils::serialize(keys, index);
+        const mapped_dictionary<6> dictionary(file.data(), file.size());
+        EXPECT_EQ(dictionary.has_hash_index(), index == dictionary_index::hash);
+
+        auto expected = keys;
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+        EXPECT_EQ(dictionary.size(), expected.size());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(dictionary[0].data()) % 64, reinterpret_cast<std::uintptr_t>(file.data()) % 64);
+
+        bool all_found = true;
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            all_found &= dictionary[i] == expected[i];
+            all_found &= dictionary.find(expected[i]) == i && dictionary.find_sorted(expected[i]) == i;
+        }
+        EXPECT_TRUE(all_found);
+        EXPECT_EQ(dictionary.find("zzzzzz"), mapped_dictionary<6>::npos);
+        EXPECT_EQ(dictionary.find("AAA"), mapped_dictionary<6>::npos);
+        EXPECT_FALSE(dictionary.contains("AAAAAAA"));
+        EXPECT_TRUE(utils::throws<std::out_of_range>([&] { (void)dictionary.at(expected.size()); }));
+
+        for (const std::string_view prefix : {"", "A", "AB", "ABCD", "DDDDDD", "E", "ABCDABC"})
+        {
+            const auto [first, last] = dictionary.prefix_range(prefix);
+            const auto begin = std::find_if(expected.begin(), expected.end(), [&](const auto& key) { return std::string_view(key).substr(0, prefix.size()) >= prefix; });
+            const auto end = std::find_if(begin, expected.end(), [&](const auto& key) { return std::string_view(key).substr(0, prefix.size()) != prefix; });
+            EXPECT_EQ(first, prefix.size() > 6 ? expected.size() : static_cast<size_t>(begin - expected.begin()));
+            EXPECT_EQ(last, prefix.size() > 6 ? expected.size() : static_cast<size_t>(end - expected.begin()));
+        }
+        EXPECT_EQ(dictionary.lower_bound("B"), dictionary.prefix_range("B").first);
+        EXPECT_EQ(dictionary.lower_bound("BAAAAA"), dictionary.prefix_range("B").first);
+    }
+}
+
+TEST(MappedDictionaryTest, RejectsDamagedFiles) {
+    const auto        keys = utils::make_keys(100);
+    const std::string file = utils::serialize(keys, dictionary_index::hash);
+    const auto        rejects = [](std::string damaged) {
+        return utils::throws<std::runtime_error>([&] { mapped_dictionary<6> dictionary(damaged.data(), damaged.size()); });
+    };
+    EXPECT_FALSE(rejects(file));
+    EXPECT_TRUE(rejects(file.substr(0, 32)));
+    EXPECT_TRUE(rejects(file.substr(0, file.size() - 1)));
+    EXPECT_TRUE(rejects("X" + file.substr(1)));
+    EXPECT_TRUE(utils::throws<std::runtime_error>([&] { mapped_dictionary<5> dictionary(file.data(), file.size()); }));
+
+    // a damaged index loses lookups but never reads outside the keys
+    std::string damaged = file;
+    for (size_t i = damaged.size() - 256; i < damaged.size(); ++i)
+        damaged[i] = '\xff';
+    const mapped_dictionary<6> dictionary(damaged.data(), damaged.size());
+    for (const auto& key : keys)
+        (void)dictionary.find(key);
+}
+
+TEST(MappedDictionaryTest, HashIndexIsPinned) {
+    // the slots written into a file must not move with the hash function: a change needs a new hash id
+    const fixed_string<6> key = "ABCDAB";
+    static_assert(fixstr::hash{}(fixed_string<6>("ABCDAB")) == 0x98af77bf40ea4b86ULL);
+    const std::string file = utils::serialize({key}, dictionary_index::hash);
+    std::uint32_t     slots[16];
+    EXPECT_EQ(file.size(), 128 + sizeof(slots));
+    std::memcpy(slots, file.data() + 128, sizeof(slots));
+    EXPECT_EQ(slots[0x98af77bf40ea4b86ULL & 15], 1u);
+    EXPECT_EQ(std::count(std::begin(slots), std::end(slots), 0u), 15);
+
+    // the hash id follows the index kind in the header
+    const auto rejects = [](std::string damaged) {
+        return utils::throws<std::runtime_error>([&] { mapped_dictionary<6> dictionary(damaged.data(), damaged.size()); });
+    };
+    std::string unknown_hash = file;
+    unknown_hash[44] = '\x02';
+    EXPECT_TRUE(rejects(unknown_hash));
+    std::string old_version = file;
+    old_version[12] = '\x01';
+    EXPECT_TRUE(rejects(old_version));
+}
+
+#if FIXSTR_MMAP_PRESENT
+TEST(MappedDictionaryTest, MapsFiles) {
+    const auto        keys = utils::make_keys(500);
+    const std::string path = "fixstr_mapped_dictionary_test.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        mapped_dictionary<6>::write(out, keys.begin(), keys.end());
+    }
+    mapped_dictionary<6> dictionary(path);
+    EXPECT_TRUE(dictionary.has_hash_index());
+    EXPECT_TRUE(dictionary.contains(keys[123]));
+
+    mapped_dictionary<6> moved = std::move(dictionary);
+    EXPECT_TRUE(dictionary.empty());
+    EXPECT_TRUE(moved.contains(keys[321]));
+    std::remove(path.c_str());
+
+    EXPECT_TRUE(utils::throws<std::system_error>([] { mapped_dictionary<6> missing(std::string("no/such/dictionary.bin")); }));
+}
+#endif // FIXSTR_MMAP_PRESENT
@@ -0,0 +1,105 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <algorithm>
+#include <minitest/minitest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fixstr/multi_search.hpp"
+#include "utils.hpp"
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+using namespace fixstr;
+
+namespace multi_search_test
+{
+using keywords = multi_searcher<"he", "she", "his", "hers">;
+
+// Every occurrence of every pattern, found naively and ordered like multi_searcher::for_each
+template <typename TSearcher>
+std::vector<multi_match> naive(std::string_view haystack)
+{
+    std::vector<multi_match> result;
+    for (size_t end = 1; end <= haystack.size(); ++end)
+    {
+        std::vector<multi_match> ending_here;
+        for (size_t p = 0; p < TSearcher::size(); ++p)
+        {
+            const auto pattern = TSearcher::pattern(p);
+            if (pattern.size() <= end && haystack.substr(end - pattern.size(), pattern.size()) == pattern)
+                ending_here.push_back({p, end - pattern.size()});
+        }
+        std::sort(ending_here.begin(), ending_here.end(), [](const auto& a, const auto& b) { return a.position < b.position; });
+        result.insert(result.end(), ending_here.begin(), ending_here.end());
+    }
+    return result;
+}
+
+template <typename TSearcher>
+std::vector<multi_match> collect(std::string_view haystack)
+{
+    std::vector<multi_match> result;
+    TSearcher::for_each(haystack, [&](const multi_match& match) { result.push_back(match); });
+    return result;
+}
+} // namespace multi_search_test
+
+TEST(MultiSearchTest, ReportsOverlappingOccurrences) {
+    using namespace multi_search_test;
+    const std::vector<multi_match> expected = {{1, 1}, {0, 2}, {3, 2}};
+    EXPECT_TRUE(collect<keywords>("ushers") == expected);
+    EXPECT_EQ(keywords::count("ushers his hers"), 6u);
+    EXPECT_TRUE(keywords::find("a his") == (multi_match{2, 2}));
+    EXPECT_TRUE(keywords::find("ushers", 2) == (multi_match{0, 2}));
+    EXPECT_FALSE(keywords::find("nothing to see"));
+    EXPECT_FALSE(keywords::contains_any(""));
+}
+
+TEST(MultiSearchTest, MatchesNaiveSearch) {
+    using namespace multi_search_test;
+    using searcher = multi_searcher<"GET ", "POST ", "HTTP/1.1", "Host:", "\r\n\r\n", "\r\n", "a", "aa", "aab", "ab", "bab", "abba">;
+
+    std::string   haystack = "POST /a HTTP/1.1\r\nHost: abba\r\n\r\nGET /aab HTTP/1.1\r\n\r\n";
+    utils::lcg    random(7);
+    for (size_t i = 0; i < 2000; ++i)
+        haystack.push_back("ab \r\nPOST"[random() % 9]);
+    EXPECT_TRUE(collect<searcher>(haystack) == naive<searcher>(haystack));
+
+    size_t stopped_after = 0;
+    searcher::for_each(haystack, [&](const multi_match&) { return ++stopped_after < 3; });
+    EXPECT_EQ(stopped_after, 3u);
+}
+
+TEST(MultiSearchTest, WorksDuringConstantEvaluation) {
+    using multi_search_test::keywords;
+    static_assert(keywords::count("ushers") == 3);
+    static_assert(keywords::find("this") == multi_match{2, 1});
+    static_assert(keywords::pattern(3) == "hers");
+    static_assert(multi_searcher<u8"café", u8"été">::find(u8"un été au café") == multi_match{1, 3});
+}
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
@@ -0,0 +1,183 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <sstream>
+#include <string>
+
+#include "fixstr/record.hpp"
+#include "utils.hpp"
+
+using namespace fixstr;
+
+namespace utils
+{
+
+// Trims every width of a buffer with every value length so that the scalar, SWAR and SSE2 paths and their block boundaries are covered
+template <size_t N>
+bool trims_every_length()
+{
+    for (size_t length = 0; length <= N; ++length)
+    {
+        std::string right(N, ' ');
+        std::string left(N, '0');
+        for (size_t i = 0; i < length; ++i)
+        {
+            right[i] = static_cast<char>('a' + i % 26);
+            left[N - length + i] = static_cast<char>('1' + i % 9);
+        }
+        // padding characters inside the value are kept
+        if (length > 2)
+        {
+            right[1] = ' ';
+            left[N - length + 1] = '0';
+        }
+        if (padded_view<N>(right.data()).trimmed() != std::string_view(right).substr(0, length))
+            return false;
+        if (padded_view<N, zero_padded>(left.data()).trimmed() != std::string_view(left).substr(length == 0 ? N - 1 : N - length))
+            return false;
+    }
+    return true;
+}
+} // namespace utils
+
+TEST(PaddedTest, Trimming) {
+    constexpr padded_view<8> symbol("AAPL    ");
+    static_assert(symbol.trimmed() == "AAPL");
+    static_assert(padded_view<6, zero_padded>("000420").trimmed() == "420");
+    static_assert(padded_view<4>("    ").empty());
+    static_assert(padded_view<6, zero_padded>("000000").trimmed() == "0");
+    static_assert(padded_view<6, pad_left<' '>>("      ").empty());
+
+    EXPECT_TRUE(utils::trims_every_length<1>());
+    EXPECT_TRUE(utils::trims_every_length<7>());
+    EXPECT_TRUE(utils::trims_every_length<8>());
+    EXPECT_TRUE(utils::trims_every_length<12>());
+    EXPECT_TRUE(utils::trims_every_length<16>());
+    EXPECT_TRUE(utils::trims_every_length<20>());
+    EXPECT_TRUE(utils::trims_every_length<32>());
+    EXPECT_TRUE(utils::trims_every_length<45>());
+
+    const padded_view<8> runtime(std::string("MSFT    ").data());
+    EXPECT_EQ(runtime.trimmed(), std::string_view("MSFT"));
+    EXPECT_EQ(runtime.raw(), fixed_string<8>("MSFT    "));
+}
+
+TEST(PaddedTest, Encoding) {
+    constexpr padded_string<8> symbol("IBM");
+    static_assert(symbol.raw() == fixed_string<8>("IBM     "));
+    static_assert(symbol.trimmed() == "IBM");
+    static_assert(padded_string<6, zero_padded>("42").raw() == fixed_string<6>("000042"));
+    static_assert(padded_string<6, zero_padded>("0").trimmed() == "0");
+    static_assert(padded_string<6, zero_padded>("0") == "0");
+    static_assert(padded_string<4>().raw() == fixed_string<4>("    "));
+    static_assert(sizeof(padded_string<8>) == 8);
+
+    EXPECT_TRUE(utils::throws<std::length_error>([] { padded_string<4> too_long(std::string_view("TOOLONG")); }));
+    EXPECT_EQ(padded_string<4>::truncate("TOOLONG").trimmed(), std::string_view("TOOL"));
+    EXPECT_EQ((padded_string<4, zero_padded>::truncate("123456").trimmed()), std::string_view("1234"));
+}
+
+TEST(PaddedTest, Comparisons) {
+    const padded_string<8> aapl("AAPL");
+    const padded_string<8> ibm("IBM");
+    const padded_view<8>   view("AAPL    ");
+
+    EXPECT_TRUE(aapl == view);
+    EXPECT_TRUE(view == aapl);
+    EXPECT_TRUE(aapl != ibm);
+    EXPECT_TRUE(aapl < ibm);
+    EXPECT_TRUE(ibm >= view);
+    EXPECT_TRUE(aapl == "AAPL");
+    EXPECT_TRUE("AAPL" == view);
+    EXPECT_TRUE(view == std::string("AAPL"));
+    EXPECT_TRUE(view != std::string_view("AAPL "));
+    EXPECT_TRUE(std::string_view("AAP") < view);
+    EXPECT_TRUE(view > "AAP");
+
+    // different widths compare by value
+    EXPECT_TRUE(padded_string<4>("AAPL") == view);
+
+    // zero-padded digits of the same width order numerically
+    EXPECT_TRUE((padded_string<6, zero_padded>("99") < padded_string<6, zero_padded>("100")));
+    EXPECT_TRUE((padded_string<6, zero_padded>("42") == "42"));
+
+    // comparisons with text and with fields of another layout use the same order as the raw bytes
+    const padded_string<6, zero_padded> large("1234");
+    const padded_string<6, zero_padded> small("999");
+    EXPECT_TRUE(small < large);
+    EXPECT_FALSE(large < "999");
+    EXPECT_TRUE(large > "999");
+    EXPECT_TRUE("999" < large);
+    EXPECT_TRUE(small < std::string_view("1234"));
+    EXPECT_TRUE((padded_string<8, zero_padded>("999") < large));
+    EXPECT_TRUE((large > padded_string<8, zero_padded>("999")));
+    EXPECT_TRUE(padded_string<8>("999") < large);
+    EXPECT_TRUE(padded_string<8>("1234") < padded_string<8>("999"));
+
+    std::ostringstream out;
+    out << '[' << view << ']';
+    EXPECT_EQ(out.str(), "[AAPL]");
+}
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace
+{
+using order = record<field<"symbol", 8>, field<"side", 1>, field<"quantity", 6, zero_padded>, field<"account", 12>>;
+} // namespace
+
+TEST(RecordTest, Layout) {
+    static_assert(order::size == 27);
+    static_assert(order::offset_of<"symbol"> == 0);
+    static_assert(order::offset_of<"side"> == 8);
+    static_assert(order::offset_of<"quantity"> == 9);
+    static_assert(order::offset_of<"account"> == 15);
+    static_assert(std::is_same_v<order::field_type<"quantity">::view_type, padded_view<6, zero_padded>>);
+}
+
+TEST(RecordTest, GetAndSet) {
+    static constexpr char message[] = "AAPL    B000150ACC-7       ";
+    constexpr order       parsed(message);
+    static_assert(parsed.get<"symbol">() == "AAPL");
+    static_assert(parsed.get<"side">() == "B");
+    static_assert(parsed.get<"quantity">().trimmed() == "150");
+    static_assert(parsed.get<"account">().trimmed() == "ACC-7");
+    static_assert(parsed.get<"symbol">().data() == message);
+
+    char buffer[order::size];
+    order::set<"symbol">(buffer, "MSFT");
+    order::set<"side">(buffer, "S");
+    order::set<"quantity">(buffer, "42");
+    order::set<"account">(buffer, "ACC-12345678");
+    EXPECT_EQ(std::string_view(buffer, order::size), std::string_view("MSFT    S000042ACC-12345678"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { order::set<"side">(buffer, "BS"); }));
+
+    const order view(std::string_view(buffer, order::size));
+    EXPECT_TRUE(view.get<"symbol">() == padded_string<8>("MSFT"));
+    EXPECT_EQ(view.get<"account">().trimmed(), std::string_view("ACC-12345678"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { order too_short(std::string_view(buffer, order::size - 1)); }));
+}
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
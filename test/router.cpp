@@ -0,0 +1,115 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <string_view>
+
+#include "fixstr/router.hpp"
+
+using namespace fixstr;
+using namespace std::string_view_literals;
+
+namespace router_test
+{
+using user = route<"/users/{id:int}">;
+using user_orders = route<"/users/{id:int}/orders/{oid}">;
+using user_profile = route<"/users/me">;
+using user_by_name = route<"/users/{name}/settings">;
+using health = route<"/health">;
+using root = route<"/">;
+
+using api = router<user, user_orders, user_profile, user_by_name, health, root>;
+} // namespace router_test
+
+using namespace router_test;
+
+TEST(RouterTest, RoutePatternIsParsedAtCompileTime) {
+    static_assert(user_orders::segment_count == 4);
+    static_assert(user_orders::param_count == 2);
+    static_assert(user_orders::segments[0].kind == route_segment_kind::literal && user_orders::segments[0].text == "users"sv);
+    static_assert(user_orders::segments[1].kind == route_segment_kind::integer && user_orders::segments[1].text == "id"sv);
+    static_assert(user_orders::segments[3].kind == route_segment_kind::string && user_orders::segments[3].text == "oid"sv);
+    static_assert(user_orders::param_index<"oid"> == 1);
+    static_assert(route<"/a/{x:str}">::segments[1].kind == route_segment_kind::string);
+    static_assert(root::segment_count == 1 && root::segments[0].text.empty());
+}
+
+TEST(RouterTest, SingleRouteMatch) {
+    constexpr auto match = user_orders::match("/users/42/orders/A-7?expand=items");
+    static_assert(match && match.route == 0);
+    static_assert(user_orders::get<"id">(match) == 42);
+    static_assert(user_orders::get<"oid">(match) == "A-7"sv);
+
+    EXPECT_FALSE(user_orders::match("/users/42/orders"));
+    EXPECT_FALSE(user_orders::match("/users/42/orders/A-7/"));
+    EXPECT_FALSE(user_orders::match("/users/x/orders/A-7"));
+    EXPECT_FALSE(user_orders::match("users/42/orders/A-7"));
+    EXPECT_FALSE(user_orders::match("/users/42/orders/"));
+}
+
+TEST(RouterTest, RouterSelectsRouteAndCapturesParameters) {
+    static_assert(api::size() == 6);
+    static_assert(api::max_params == 2);
+
+    constexpr auto orders = api::match("/users/-17/orders/xyz");
+    static_assert(orders.route == 1);
+    static_assert(api::route_type<1>::get<"id">(orders) == -17);
+    static_assert(api::route_type<1>::get<"oid">(orders) == "xyz"sv);
+
+    const auto by_id = api::match("/users/9000#top");
+    EXPECT_EQ(by_id.route, 0u);
+    EXPECT_EQ(user::get<"id">(by_id), 9000);
+    EXPECT_EQ(by_id[0].text, "9000"sv);
+
+    EXPECT_EQ(api::match("/health").route, 4u);
+    EXPECT_EQ(api::match("/").route, 5u);
+    EXPECT_FALSE(api::match(""));
+    EXPECT_FALSE(api::match("/health/"));
+    EXPECT_FALSE(api::match("/users"));
+    EXPECT_FALSE(api::match("/unknown"));
+}
+
+TEST(RouterTest, LiteralsTakePrecedenceAndBacktrack) {
+    // a literal segment wins over captures at the same position
+    EXPECT_EQ(api::match("/users/me").route, 2u);
+
+    // "me" and "42" match the literal and integer branches first, the string capture is reached by backtracking
+    const auto me = api::match("/users/me/settings");
+    EXPECT_EQ(me.route, 3u);
+    EXPECT_EQ(user_by_name::get<"name">(me), "me"sv);
+    const auto numeric = api::match("/users/42/settings");
+    EXPECT_EQ(numeric.route, 3u);
+    EXPECT_EQ(user_by_name::get<"name">(numeric), "42"sv);
+}
+
+TEST(RouterTest, IntegerCapturesRejectOverflow) {
+    EXPECT_EQ(user::get<"id">(user::match("/users/9223372036854775807")), 9223372036854775807);
+    EXPECT_EQ(user::get<"id">(user::match("/users/-9223372036854775808")), -9223372036854775807 - 1);
+    EXPECT_FALSE(user::match("/users/9223372036854775808"));
+    EXPECT_FALSE(user::match("/users/-"));
+    EXPECT_FALSE(user::match("/users/1e3"));
+
+    // the overflowing segment still matches a string capture
+    EXPECT_EQ(api::match("/users/99999999999999999999/settings").route, 3u);
+}
@@ -0,0 +1,206 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fixstr/shm_table.hpp"
+#include "utils.hpp"
+
+#if FIXSTR_SHM_PRESENT
+#include <sys/wait.h>
+#endif // FIXSTR_SHM_PRESENT
+
+using namespace fixstr;
+
+namespace utils
+{
+
+// A torn read would break the relation between the two halves
+struct quote
+{
+    std::uint64_t version;
+    std::uint64_t check;
+};
+
+quote make_quote(std::uint64_t version) noexcept
+{
+    return {version, ~version};
+}
+
+struct region
+{
+    explicit region(size_t size) : storage(size / sizeof(std::uint64_t) + 1) {}
+    void*                      data() noexcept { return storage.data(); }
+    size_t                     size() const noexcept { return storage.size() * sizeof(std::uint64_t); }
+    std::vector<std::uint64_t> storage;
+};
+} // namespace utils
+
+TEST(ShmTableTest, InsertFindErase) {
+    using table_type = shm_table<4, int>;
+    utils::region memory(table_type::required_size(64));
+    auto          table = table_type::create(memory.data(), memory.size(), 64);
+    EXPECT_EQ(table.capacity(), 64u);
+
+    EXPECT_TRUE(table.insert_or_assign("AAPL", 1));
+    EXPECT_TRUE(table.insert_or_assign(fixed_string<4>("MSFT"), 2));
+    EXPECT_FALSE(table.insert_or_assign("AAPL", 3));
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_EQ(table.find("AAPL").value_or(0), 3);
+    EXPECT_EQ(table.find(std::string("MSFT")).value_or(0), 2);
+    EXPECT_FALSE(table.find("IBM ").has_value());
+    EXPECT_FALSE(table.contains("AAPLX"));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { table.insert_or_assign("IBM", 1); }));
+
+    EXPECT_TRUE(table.erase("AAPL"));
+    EXPECT_FALSE(table.erase("AAPL"));
+    EXPECT_FALSE(table.contains("AAPL"));
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_TRUE(table.insert_or_assign("AAPL", 4));
+    EXPECT_EQ(table.find("AAPL").value_or(0), 4);
+
+    // a second view of the same region, as another process would see it
+    const auto reader = table_type::attach(memory.data(), memory.size());
+    EXPECT_EQ(reader.find("MSFT").value_or(0), 2);
+    EXPECT_TRUE(utils::throws<std::runtime_error>([&] { (void)shm_table<4, long long>::attach(memory.data(), memory.size()); }));
+    EXPECT_TRUE(utils::throws<std::runtime_error>([&] { (void)table_type::attach(memory.data(), 200); }));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { (void)table_type::create(memory.data(), 100, 64); }));
+}
+
+TEST(ShmTableTest, Full) {
+    using table_type = shm_table<8, int>;
+    utils::region memory(table_type::required_size(16));
+    auto          table = table_type::create(memory.data(), memory.size(), 16);
+    EXPECT_EQ(table.capacity(), 16u);
+    for (std::uint32_t i = 0; i < 16; ++i)
+        table.insert_or_assign(utils::make_key<8>(i), static_cast<int>(i));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { table.insert_or_assign(utils::make_key<8>(16), 16); }));
+    for (std::uint32_t i = 0; i < 17; ++i)
+        EXPECT_EQ(table.find(utils::make_key<8>(i)).value_or(-1), i < 16 ? static_cast<int>(i) : -1);
+
+    // erased keys keep their slots: they can come back, new keys still do not fit
+    EXPECT_TRUE(table.erase(utils::make_key<8>(3)));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { table.insert_or_assign(utils::make_key<8>(16), 16); }));
+    EXPECT_TRUE(table.insert_or_assign(utils::make_key<8>(3), 33));
+    EXPECT_EQ(table.find(utils::make_key<8>(3)).value_or(-1), 33);
+}
+
+// The sequence of a slot wraps around after 2^31 writes, the slot keeps its key
+TEST(ShmTableTest, SequenceWrapAround) {
+    using table_type = shm_table<8, int>;
+    utils::region memory(table_type::required_size(16));
+    auto          table = table_type::create(memory.data(), memory.size(), 16);
+    const auto    key = utils::make_key<8>(5);
+    EXPECT_TRUE(table.insert_or_assign(key, 1));
+
+    auto* slots = reinterpret_cast<details::shm::slot<8, int>*>(static_cast<char*>(memory.data()) + sizeof(details::shm::header));
+    auto* slot = slots;
+    while (std::string_view(slot->key, 8) != std::string_view(key))
+        ++slot;
+    slot->sequence.store(0xFFFFFFFEu);
+
+    EXPECT_FALSE(table.insert_or_assign(key, 2));
+    EXPECT_EQ(slot->sequence.load(), 0u);
+    EXPECT_EQ(table.find(key).value_or(-1), 2);
+    EXPECT_FALSE(table.insert_or_assign(key, 3));
+    EXPECT_EQ(table.find(key).value_or(-1), 3);
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_TRUE(table.erase(key));
+    EXPECT_FALSE(table.contains(key));
+    EXPECT_EQ(table.size(), 0u);
+}
+
+#if FIXSTR_SHM_PRESENT
+TEST(ShmTableTest, NamedSharedMemory) {
+    const std::string name = "/fixstr_shm_table_test_" + std::to_string(::getpid());
+    auto              writer = shm_table<8, int>::create_shared(name, 100);
+    const auto        reader = shm_table<8, int>::open_shared(name);
+    shm_table<8, int>::remove_shared(name);
+    writer.insert_or_assign(utils::make_key<8>(7), 7);
+    EXPECT_EQ(reader.find(utils::make_key<8>(7)).value_or(0), 7);
+    EXPECT_TRUE(utils::throws<std::system_error>([&] { (void)shm_table<8, int>::open_shared(name); }));
+}
+
+// Reader processes check every value they see while the writer inserts and updates keys, then wait for the final values
+TEST(ShmTableTest, MultiProcessStress) {
+    using table_type = shm_table<8, utils::quote>;
+    constexpr std::uint32_t keys = 500;
+    constexpr std::uint64_t rounds = 2000;
+    constexpr int           readers = 3;
+
+    const size_t size = table_type::required_size(keys);
+    void*        memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    EXPECT_TRUE(memory != MAP_FAILED);
+    if (memory == MAP_FAILED)
+        return;
+    auto table = table_type::create(memory, size, keys);
+
+    std::vector<pid_t> children;
+    for (int r = 0; r < readers; ++r)
+    {
+        const pid_t pid = ::fork();
+        if (pid == 0)
+        {
+            const auto view = table_type::attach(memory, size);
+            bool       consistent = true;
+            for (std::uint32_t done = 0; done < keys;)
+            {
+                done = 0;
+                for (std::uint32_t i = 0; i < keys; ++i)
+                {
+                    if (const auto quote = view.find(utils::make_key<8>(i)))
+                    {
+                        consistent &= quote->check == ~quote->version && quote->version <= rounds;
+                        done += quote->version == rounds;
+                    }
+                }
+            }
+            ::_exit(consistent ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+
+    for (std::uint64_t round = 0; round <= rounds; ++round)
+    {
+        for (std::uint32_t i = 0; i < keys; ++i)
+        {
+            if (round % 7 == 3 && i % 5 == 0)
+                table.erase(utils::make_key<8>(i));
+            else
+                table.insert_or_assign(utils::make_key<8>(i), utils::make_quote(round));
+        }
+    }
+
+    for (const auto pid : children)
+    {
+        int status = -1;
+        ::waitpid(pid, &status, 0);
+        EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+    ::munmap(memory, size);
+}
+#endif // FIXSTR_SHM_PRESENT
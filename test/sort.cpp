@@ -0,0 +1,109 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "fixstr/sort.hpp"
+#include "utils.hpp"
+
+using namespace fixstr;
+
+namespace utils
+{
+// Keys over a few characters, including bytes above 0x7f, so that there are long shared prefixes and many duplicates
+template <size_t N, typename TStorage = null_terminated>
+std::vector<basic_fixed_string<char, N, std::char_traits<char>, TStorage>> make_keys(size_t count, unsigned alphabet)
+{
+    std::string characters;
+    for (unsigned value = 0; value < alphabet; ++value)
+        characters.push_back(static_cast<char>(value % 2 == 0 ? 'a' + value : 0xf0 + value % 16));
+    auto result = random_keys<basic_fixed_string<char, N, std::char_traits<char>, TStorage>>(count, characters, 99);
+    // a common prefix for half of the keys
+    for (size_t i = 0; i < count; i += 2)
+        result[i][0] = 'Q';
+    return result;
+}
+
+template <typename TKeys>
+bool sorts_like_std(TKeys keys, unsigned threads)
+{
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+    fixstr::sort(keys.begin(), keys.end(), threads);
+    return keys == expected;
+}
+
+template <typename TKeys>
+bool sorts_unique_like_std(TKeys keys, unsigned threads)
+{
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+    keys.erase(fixstr::sort_unique(keys.begin(), keys.end(), threads), keys.end());
+    return keys == expected;
+}
+} // namespace utils
+
+TEST(SortTest, MatchesStdSort) {
+    for (const size_t count : {size_t(0), size_t(1), size_t(63), size_t(64), size_t(5000)})
+    {
+        for (const unsigned alphabet : {2u, 7u, 40u})
+        {
+            EXPECT_TRUE(utils::sorts_like_std(utils::make_keys<1>(count, alphabet), 1));
+            EXPECT_TRUE(utils::sorts_like_std(utils::make_keys<5>(count, alphabet), 1));
+            EXPECT_TRUE(utils::sorts_like_std(utils::make_keys<12>(count, alphabet), 1));
+            EXPECT_TRUE(utils::sorts_like_std((utils::make_keys<12, unterminated>(count, alphabet)), 1));
+            EXPECT_TRUE(utils::sorts_unique_like_std(utils::make_keys<3>(count, alphabet), 1));
+        }
+    }
+
+    std::vector<fixed_string<3>> keys = {fixed_string<3>("CBA"), fixed_string<3>("ABC"), fixed_string<3>("BCA")};
+    fixstr::sort(keys.begin(), keys.end());
+    EXPECT_TRUE(keys[0] == fixed_string<3>("ABC") && keys[2] == fixed_string<3>("CBA"));
+}
+
+TEST(SortTest, Parallel) {
+    for (const unsigned threads : {2u, 5u})
+    {
+        EXPECT_TRUE(utils::sorts_like_std(utils::make_keys<8>(70000, 40), threads));
+        EXPECT_TRUE(utils::sorts_like_std(utils::make_keys<8>(70000, 2), threads));
+        EXPECT_TRUE(utils::sorts_unique_like_std(utils::make_keys<4>(70000, 7), threads));
+        EXPECT_TRUE(utils::sorts_unique_like_std(utils::make_keys<6>(70000, 40), threads));
+    }
+    EXPECT_TRUE(utils::sorts_like_std(utils::make_keys<8>(70000, 40), 0));
+
+    // keys with common leading bytes are split on the first byte that differs
+    auto order_ids = utils::make_keys<12>(70000, 40);
+    for (auto& id : order_ids)
+        std::fill(id.begin(), id.begin() + 5, '0');
+    EXPECT_TRUE(utils::sorts_like_std(order_ids, 3));
+    EXPECT_TRUE(utils::sorts_unique_like_std(order_ids, 3));
+
+    const std::vector<fixed_string<4>> same(70000, fixed_string<4>("AAAA"));
+    EXPECT_TRUE(utils::sorts_like_std(same, 3));
+    EXPECT_TRUE(utils::sorts_unique_like_std(same, 3));
+}
@@ -0,0 +1,124 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "fixstr/static_map.hpp"
+#include "utils.hpp"
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+using namespace fixstr;
+
+namespace static_map_test
+{
+using methods = static_map<map_entry{"GET", 1}, map_entry{"HEAD", 2}, map_entry{"POST", 3}, map_entry{"PUT", 4}, map_entry{"DELETE", 5},
+                           map_entry{"CONNECT", 6}, map_entry{"OPTIONS", 7}, map_entry{"TRACE", 8}, map_entry{"PATCH", 9}>;
+
+template <size_t I>
+constexpr fixed_string<4> make_key()
+{
+    fixed_string<4> key = "k000";
+    key[1] = static_cast<char>('0' + I / 100 % 10);
+    key[2] = static_cast<char>('0' + I / 10 % 10);
+    key[3] = static_cast<char>('0' + I % 10);
+    return key;
+}
+
+template <size_t... Is>
+constexpr auto make_large_map(std::index_sequence<Is...>)
+{
+    return static_map<map_entry{make_key<Is>(), Is}...>{};
+}
+
+using large = decltype(make_large_map(std::make_index_sequence<500>{}));
+} // namespace static_map_test
+
+TEST(StaticMapTest, FindsEveryKey) {
+    using static_map_test::methods;
+    EXPECT_EQ(methods::size(), 9u);
+    for (size_t i = 0; i < methods::size(); ++i)
+    {
+        EXPECT_EQ(methods::index_of(methods::key(i)), i);
+        EXPECT_EQ(methods::at(methods::key(i)), static_cast<int>(i + 1));
+    }
+    EXPECT_EQ(*methods::find("PATCH"), 9);
+}
+
+TEST(StaticMapTest, MissingKeysAreNotFound) {
+    using static_map_test::methods;
+    EXPECT_EQ(methods::find("GETS"), nullptr);
+    EXPECT_EQ(methods::find("GE"), nullptr);
+    EXPECT_EQ(methods::find(""), nullptr);
+    EXPECT_FALSE(methods::contains("get"));
+    EXPECT_EQ(methods::index_of("PUTS"), methods::npos);
+
+    bool thrown = false;
+    try
+    {
+        (void)methods::at("UNKNOWN");
+    }
+    catch (const std::out_of_range&)
+    {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+}
+
+TEST(StaticMapTest, ConstexprLookup) {
+    using static_map_test::methods;
+    static_assert(methods::at("DELETE") == 5);
+    static_assert(!methods::contains("delete"));
+    static_assert(methods::index_of(fixed_string{"TRACE"}) == 7);
+}
+
+TEST(StaticMapTest, LargeKeySet) {
+    using static_map_test::large;
+    EXPECT_EQ(large::size(), 500u);
+    for (size_t i = 0; i < large::size(); ++i)
+    {
+        const std::string key(large::key(i));
+        EXPECT_EQ(large::at(key), i);
+    }
+    EXPECT_FALSE(large::contains("k500"));
+    EXPECT_FALSE(large::contains("k00"));
+}
+
+TEST(StaticMapTest, WideCharacterKeys) {
+    using wide = static_map<map_entry{u"alpha", 'a'}, map_entry{u"beta", 'b'}, map_entry{u"gamma", 'g'}>;
+    EXPECT_EQ(wide::at(u"beta"), 'b');
+    EXPECT_FALSE(wide::contains(u"delta"));
+}
+
+TEST(StaticMapTest, DuplicateKeysAreRejected) {
+    using keys = std::array<std::string_view, 3>;
+    EXPECT_TRUE(utils::throws<std::logic_error>([] { (void)details::phf::build<1, 4>(keys{"GET", "PUT", "GET"}); }));
+    EXPECT_FALSE(utils::throws<std::logic_error>([] { (void)details::phf::build<1, 4>(keys{"GET", "PUT", "POST"}); }));
+}
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
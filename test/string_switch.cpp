@@ -0,0 +1,102 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "fixstr/string_switch.hpp"
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+
+using namespace fixstr;
+
+namespace string_switch_test
+{
+using small = switch_table<"NEW", "CANCEL", "REPLACE">;
+using tags = switch_table<"NEW", "CANCEL", "REPLACE", "STATUS", "REJECT", "FILL", "PARTIAL", "EXPIRE", "RESTATE", "SUSPEND", "HEARTBEAT",
+                          "LOGON", "LOGOUT", "TRADE", "QUOTE">;
+using ambiguous = switch_table<"ab", "ba", "aa", "bb", "abc", "xyz">;
+
+template <typename TTable>
+void check_all_keys()
+{
+    for (size_t i = 0; i < TTable::size(); ++i)
+    {
+        const std::string key(TTable::key(i));
+        EXPECT_EQ(TTable::index_of(key), i);
+        EXPECT_EQ(TTable::index_of(key + "X"), TTable::npos);
+        EXPECT_EQ(TTable::index_of(std::string_view(key).substr(1)), TTable::npos);
+        std::string changed = key;
+        changed.back() = '?';
+        EXPECT_EQ(TTable::index_of(changed), TTable::npos);
+    }
+    EXPECT_EQ(TTable::index_of(""), TTable::npos);
+    EXPECT_EQ(TTable::index_of(std::string(300, 'A')), TTable::npos);
+}
+} // namespace string_switch_test
+
+TEST(StringSwitchTest, StrategyFollowsTheKeySet) {
+    using namespace string_switch_test;
+    static_assert(small::strategy == string_switch_strategy::linear);
+    static_assert(tags::strategy == string_switch_strategy::length_and_byte);
+    static_assert(ambiguous::strategy == string_switch_strategy::perfect_hash);
+}
+
+TEST(StringSwitchTest, FindsEveryKeyAndRejectsOthers) {
+    using namespace string_switch_test;
+    check_all_keys<small>();
+    check_all_keys<tags>();
+    check_all_keys<ambiguous>();
+    EXPECT_EQ((string_switch<"NEW", "CANCEL">("CANCEL")), 1u);
+    using pair = switch_table<"NEW", "CANCEL">;
+    EXPECT_EQ((string_switch<"NEW", "CANCEL">("CANCE")), pair::npos);
+}
+
+TEST(StringSwitchTest, DispatchesToVisitor) {
+    const auto describe = [](auto index) -> std::string {
+        if constexpr (index == 0)
+            return "order";
+        else if constexpr (index == 1)
+            return "cancel";
+        else
+            return "unknown";
+    };
+    EXPECT_EQ((string_switch<"NEW", "CANCEL">("NEW", describe)), "order");
+    EXPECT_EQ((string_switch<"NEW", "CANCEL">("CANCEL", describe)), "cancel");
+    EXPECT_EQ((string_switch<"NEW", "CANCEL">("AMEND", describe)), "unknown");
+}
+
+TEST(StringSwitchTest, ConstexprLookup) {
+    using namespace string_switch_test;
+    static_assert(small::index_of("REPLACE") == 2);
+    static_assert(tags::index_of("SUSPEND") == 9);
+    static_assert(tags::index_of("SUSPENT") == tags::npos);
+    static_assert(ambiguous::index_of("bb") == 3);
+    static_assert(string_switch<u"alpha", u"beta">(u"beta") == 1);
+    static_assert(string_switch<"a", "b">("b", [](auto index) { return index + 10; }) == 11);
+}
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
@@ -24,9 +24,12 @@
 
 #include <algorithm>
 #include <minitest/minitest.h>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "fixed_string.hpp"
+#include "utils.hpp"
 
 constexpr std::size_t default_size = 15;
 
@@ -524,8 +527,160 @@ TEST(FixedStringTest, OperatorPlus) {
     check<fixed_u32string>();
 }
 
+namespace concatenation
+{
+template <typename TChar>
+constexpr TChar comma_v = static_cast<TChar>(',');
+
+struct custom_traits : std::char_traits<char>
+{
+};
+
+template <template <std::size_t> class T>
+void check()
+{
+    using char_t = typename T<0>::value_type;
+    using sv_t = typename T<0>::string_view_type;
+
+    const auto first = utils::to_fs<char_t>("Hello");
+    const auto second = utils::to_fs<char_t>("World");
+    const auto comma = static_cast<char_t>(',');
+    const auto space = static_cast<char_t>(' ');
+
+    const auto result = concat(first, comma, space, second);
+    static_assert(std::is_same_v<decltype(result), const basic_fixed_string<char_t, 12>>);
+    std::basic_string<char_t> expected = first.data();
+    expected += comma;
+    expected += space;
+    expected += second.data();
+    EXPECT_EQ(static_cast<sv_t>(result), expected);
+    EXPECT_EQ(static_cast<sv_t>(concat(first)), sv_t(first));
+    EXPECT_EQ(static_cast<sv_t>(first + comma + space + second), expected);
+
+    const auto joined = join<comma_v<char_t>>(first, second, first);
+    EXPECT_EQ(static_cast<sv_t>(joined), static_cast<sv_t>(first + comma + second + comma + first));
+    EXPECT_EQ(static_cast<sv_t>(join<comma_v<char_t>>(first)), sv_t(first));
+}
+} // namespace concatenation
+
+TEST(FixedStringTest, VariadicConcat) {
+    using namespace concatenation;
+    check<fixed_string>();
+    check<fixed_wstring>();
+#if FIXSTR_CPP20_CHAR8T_PRESENT
+    check<fixed_u8string>();
+#endif // FIXSTR_CPP20_CHAR8T_PRESENT
+    check<fixed_u16string>();
+    check<fixed_u32string>();
+
+    static_assert(concat(fixed_string<1>("a"), '/', "bc", fixed_string<0>()) == fixed_string<4>("a/bc"));
+    static_assert(join<'.'>(fixed_string<3>("svc"), fixed_string<5>("shard"), "latency") == fixed_string<17>("svc.shard.latency"));
+
+    // character traits are taken from the fixed string operands
+    constexpr basic_fixed_string<char, 2, custom_traits> custom = "ab";
+    constexpr auto                                       custom_result = '<' + custom + '>';
+    static_assert(std::is_same_v<decltype(custom_result), const basic_fixed_string<char, 4, custom_traits>>);
+    static_assert(std::is_same_v<decltype(concat("<", custom)), basic_fixed_string<char, 3, custom_traits>>);
+}
+
+namespace splitting
+{
+template <typename TView>
+std::vector<std::string> pieces(const TView& view)
+{
+    std::vector<std::string> result;
+    for (const auto piece : view)
+        result.emplace_back(piece);
+    return result;
+}
+} // namespace splitting
+
+TEST(FixedStringTest, SplitView) {
+    using namespace splitting;
+    const fixed_string path = "a.bc..d";
+    EXPECT_TRUE(pieces(split_view(path, '.')) == (std::vector<std::string>{"a", "bc", "", "d"}));
+    EXPECT_TRUE(pieces(split_view(path, "..")) == (std::vector<std::string>{"a.bc", "d"}));
+    EXPECT_TRUE(pieces(split_view(path, fixed_string{"a.bc..d"})) == (std::vector<std::string>{"", ""}));
+    EXPECT_TRUE(pieces(split_view(path, "")) == (std::vector<std::string>{"a.bc..d"}));
+    EXPECT_TRUE(pieces(split_view(fixed_string{""}, '.')) == (std::vector<std::string>{""}));
+    EXPECT_TRUE(pieces(split_view(fixed_string{"."}, '.')) == (std::vector<std::string>{"", ""}));
+
+    static constexpr fixed_string key = "svc.shard.latency";
+    constexpr auto                third = [] {
+        auto it = split_view(key, '.').begin();
+        ++it;
+        ++it;
+        return *it;
+    }();
+    static_assert(third == "latency");
+
+    const fixed_wstring<5> wide = L"ab|cd";
+    const auto             view = split_view(wide, L'|');
+    EXPECT_EQ(std::distance(view.begin(), view.end()), 2);
+    EXPECT_TRUE(*std::next(view.begin()) == L"cd");
+}
+
+TEST(FixedStringTest, CaseMappingReverseAndRepeat) {
+    constexpr fixed_string header = "Content-Type: 42";
+    static_assert(to_upper(header) == fixed_string{"CONTENT-TYPE: 42"});
+    static_assert(to_lower(header) == fixed_string{"content-type: 42"});
+    static_assert(reverse(fixed_string{"abc"}) == fixed_string{"cba"});
+    static_assert(reverse(fixed_string{""}).empty());
+    static_assert(repeat<3>(fixed_string{"ab"}) == fixed_string{"ababab"});
+    static_assert(repeat<0>(fixed_string{"ab"}).empty());
+    static_assert(to_upper(fixed_u32string<3>{U"x\u00e9y"}) == fixed_u32string<3>{U"X\u00e9Y"});
+
+    // long results stay within the default constant evaluation limits
+    constexpr auto long_string = repeat<50'000>(fixed_string{"ab"});
+    static_assert(long_string.size() == 100'000);
+    static_assert(long_string[99'999] == 'b' && long_string[50'000] == 'a');
+    static_assert(reverse(long_string)[0] == 'b');
+
+    const auto runtime = repeat<4>(fixed_string{"xy"});
+    EXPECT_EQ(std::string(runtime.c_str()), "xyxyxyxy");
+}
+
 #if FIXSTR_CPP20_CNTTP_PRESENT
 
+TEST(FixedStringTest, CompileTimeTransformations) {
+    static_assert(trim<" \t key = value \n">() == fixed_string{"key = value"});
+    static_assert(trim_left<"  a  ">() == fixed_string{"a  "});
+    static_assert(trim_right<"  a  ">() == fixed_string{"  a"});
+    static_assert(trim<"   ">().empty());
+    static_assert(trim<"--a-b--", "-">() == fixed_string{"a-b"});
+    static_assert(trim<u"  wide ">() == fixed_u16string{u"wide"});
+
+    static_assert(replace<"SELECT $cols FROM $table", "$cols", "id, name">() == fixed_string{"SELECT id, name FROM $table"});
+    static_assert(replace<"a.b.c", ".", "::">() == fixed_string{"a::b::c"});
+    static_assert(replace<"aaaa", "aa", "b">() == fixed_string{"bb"});
+    static_assert(replace<"abc", "x", "yy">() == fixed_string{"abc"});
+    static_assert(replace<"a-b-c", "-", "">() == fixed_string{"abc"});
+
+    static_assert(remove<"a b  c", ' '>() == fixed_string{"abc"});
+    static_assert(remove<"   ", ' '>().empty());
+    static_assert(repeat<"=-", 3>() == fixed_string{"=-=-=-"});
+}
+
+TEST(FixedStringTest, CompileTimeSplit) {
+    constexpr auto pieces = split<"a.bc..def", '.'>();
+    static_assert(std::tuple_size_v<decltype(pieces)> == 4);
+    static_assert(std::is_same_v<std::tuple_element_t<1, decltype(pieces)>, const basic_fixed_string<char, 2>>);
+    static_assert(std::get<0>(pieces) == fixed_string{"a"});
+    static_assert(std::get<1>(pieces) == fixed_string{"bc"});
+    static_assert(std::get<2>(pieces).empty());
+    static_assert(std::get<3>(pieces) == fixed_string{"def"});
+
+    constexpr auto route = split<"/api::v1::orders", fixed_string{"::"}>();
+    static_assert(std::tuple_size_v<decltype(route)> == 3);
+    static_assert(std::get<2>(route) == fixed_string{"orders"});
+    static_assert(std::tuple_size_v<decltype(split<"", '.'>())> == 1);
+    static_assert(std::get<1>(split<u"x/y", u'/'>()) == fixed_u16string{u"y"});
+}
+
+TEST(FixedStringTest, JoinWithFixedStringSeparator) {
+    static_assert(join<fixed_string{", "}>(fixed_string{"a"}, fixed_string{"b"}, fixed_string{"c"}) == fixed_string{"a, b, c"});
+}
+
 namespace cnttp
 {
 template <fixed_string v1, fixed_string v2>
@@ -540,7 +695,310 @@ TEST(FixedStringTest, ClassNonTypeTemplateParameters) {
     check<"Hi", "Hi">();
 }
 
+namespace searching
+{
+template <basic_fixed_string Needle>
+void check(const std::string& haystack)
+{
+    const std::string_view view = haystack;
+    for (std::size_t pos = 0; pos <= view.size() + 1; pos += 7)
+        EXPECT_EQ(searcher<Needle>::find(view, pos), view.find(std::string_view(Needle), pos));
+    EXPECT_EQ(searcher<Needle>{}(view), view.find(std::string_view(Needle)));
+}
+} // namespace searching
+
+TEST(FixedStringTest, CompileTimeSearcher) {
+    constexpr fixed_string hay = "hello, world";
+    static_assert(hay.find<"world">() == 7);
+    static_assert(hay.find<"o">(5) == 8);
+    static_assert(hay.find<"">(3) == 3);
+    static_assert(hay.find<"worlds">() == fixed_string<12>::npos);
+    static_assert(hay.contains<"lo, w">());
+    static_assert(!hay.contains<"hello!">());
+
+    std::string haystack;
+    utils::lcg  random(12345);
+    for (std::size_t i = 0; i < 4000; ++i)
+        haystack.push_back(static_cast<char>('a' + random() % 3));
+    haystack += "MARKER:0123456789abcdef0123456789abcdef-MARKER";
+    haystack += haystack;
+
+    using namespace searching;
+    check<"ab">(haystack);
+    check<"cab">(haystack);
+    check<"abcabcabcabcabca">(haystack);
+    check<"MARKER:0123456789abcdef0123456789abcdef">(haystack);
+    check<"missing">(haystack);
+    check<"abcabcabcabcabcabcabcabcabcabcabcabcabcab">(haystack);
+
+    const std::u16string wide = u"payload \xFF21 marker \x0121 marker";
+    EXPECT_EQ(searcher<u"\x0121 marker">::find(wide), wide.find(u"\x0121 marker"));
+    EXPECT_EQ(searcher<u"\xFF21 marker">::find(wide), wide.find(u"\xFF21 marker"));
+}
+
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
+namespace comparison_kernels
+{
+template <typename T>
+int sign(T value)
+{
+    return (value > 0) - (value < 0);
+}
+
+template <std::size_t N>
+void check()
+{
+    // every position differs once, including bytes with the high bit set that must compare as unsigned
+    fixed_string<N> base;
+    for (std::size_t i = 0; i < N; ++i)
+        base[i] = static_cast<char>('a' + i % 26);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (const char replacement : {'\0', 'A', 'z', '\x7f', '\x80', '\xff'})
+        {
+            fixed_string<N> other = base;
+            other[i] = replacement;
+
+            const std::string_view base_sv = base;
+            const std::string_view other_sv = other;
+            EXPECT_EQ(base == other, base_sv == other_sv);
+            EXPECT_EQ(base != other, base_sv != other_sv);
+            EXPECT_EQ(base < other, base_sv < other_sv);
+            EXPECT_EQ(base <= other, base_sv <= other_sv);
+            EXPECT_EQ(base > other, base_sv > other_sv);
+            EXPECT_EQ(base >= other, base_sv >= other_sv);
+            EXPECT_EQ(other < base, other_sv < base_sv);
+#if FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+            EXPECT_EQ(sign((base <=> other) < 0 ? -1 : ((base <=> other) > 0 ? 1 : 0)), sign(base_sv.compare(other_sv)));
+#endif // FIXSTR_CPP20_SPACESHIP_OPERATOR_PRESENT
+        }
+    }
+    EXPECT_TRUE(base == fixed_string<N>(base));
+    EXPECT_FALSE(base < fixed_string<N>(base));
+}
+
+template <std::size_t... Sizes>
+void check_all(std::index_sequence<Sizes...>)
+{
+    (check<Sizes>(), ...);
+}
+} // namespace comparison_kernels
+
+TEST(FixedStringTest, SameSizeComparisonMatchesStringView) {
+    using namespace comparison_kernels;
+    check_all(std::make_index_sequence<70>{});
+
+    constexpr fixed_string<12> lhs = "AAPL.NASDAQ1";
+    constexpr fixed_string<12> rhs = "AAPL.NASDAQ2";
+    static_assert(lhs != rhs);
+    static_assert(lhs < rhs);
+    static_assert(!(rhs <= lhs));
+
+    const fixed_u32string<3> wide_lhs = U"abc";
+    const fixed_u32string<3> wide_rhs = U"abd";
+    EXPECT_TRUE(wide_lhs < wide_rhs);
+    EXPECT_FALSE(wide_lhs == wide_rhs);
+}
+
+namespace search_overloads
+{
+// every search member of fixed_string<3> gives the same answer as std::string_view for needles of size M
+template <std::size_t M>
+void check(const fixed_string<M>& needle)
+{
+    const fixed_string<3>  str = "abc";
+    const std::string_view view = str;
+    const std::string_view needle_view = needle;
+    for (std::size_t pos : {std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(3), std::string_view::npos})
+    {
+        EXPECT_EQ(str.find(needle, pos), view.find(needle_view, pos));
+        EXPECT_EQ(str.rfind(needle, pos), view.rfind(needle_view, pos));
+        EXPECT_EQ(str.find_first_of(needle, pos), view.find_first_of(needle_view, pos));
+        EXPECT_EQ(str.find_last_of(needle, pos), view.find_last_of(needle_view, pos));
+        EXPECT_EQ(str.find_first_not_of(needle, pos), view.find_first_not_of(needle_view, pos));
+        EXPECT_EQ(str.find_last_not_of(needle, pos), view.find_last_not_of(needle_view, pos));
+
+        EXPECT_EQ(str.find(needle_view, pos), view.find(needle_view, pos));
+        EXPECT_EQ(str.rfind(needle_view, pos), view.rfind(needle_view, pos));
+        EXPECT_EQ(str.find_first_of(needle_view, pos), view.find_first_of(needle_view, pos));
+        EXPECT_EQ(str.find_last_of(needle_view, pos), view.find_last_of(needle_view, pos));
+        EXPECT_EQ(str.find_first_not_of(needle_view, pos), view.find_first_not_of(needle_view, pos));
+        EXPECT_EQ(str.find_last_not_of(needle_view, pos), view.find_last_not_of(needle_view, pos));
+
+        EXPECT_EQ(str.find(needle.c_str(), pos), view.find(needle.c_str(), pos));
+        EXPECT_EQ(str.rfind(needle.c_str(), pos), view.rfind(needle.c_str(), pos));
+        EXPECT_EQ(str.find_first_of(needle.c_str(), pos), view.find_first_of(needle.c_str(), pos));
+        EXPECT_EQ(str.find_last_of(needle.c_str(), pos), view.find_last_of(needle.c_str(), pos));
+        EXPECT_EQ(str.find_first_not_of(needle.c_str(), pos), view.find_first_not_of(needle.c_str(), pos));
+        EXPECT_EQ(str.find_last_not_of(needle.c_str(), pos), view.find_last_not_of(needle.c_str(), pos));
+
+        EXPECT_EQ(str.find(needle.c_str(), pos, M), view.find(needle.c_str(), pos, M));
+        EXPECT_EQ(str.rfind(needle.c_str(), pos, M), view.rfind(needle.c_str(), pos, M));
+        EXPECT_EQ(str.find_first_of(needle.c_str(), pos, M), view.find_first_of(needle.c_str(), pos, M));
+        EXPECT_EQ(str.find_last_of(needle.c_str(), pos, M), view.find_last_of(needle.c_str(), pos, M));
+        EXPECT_EQ(str.find_first_not_of(needle.c_str(), pos, M), view.find_first_not_of(needle.c_str(), pos, M));
+        EXPECT_EQ(str.find_last_not_of(needle.c_str(), pos, M), view.find_last_not_of(needle.c_str(), pos, M));
+
+        if constexpr (M > 0)
+        {
+            EXPECT_EQ(str.find(needle[0], pos), view.find(needle[0], pos));
+            EXPECT_EQ(str.rfind(needle[0], pos), view.rfind(needle[0], pos));
+            EXPECT_EQ(str.find_first_of(needle[0], pos), view.find_first_of(needle[0], pos));
+            EXPECT_EQ(str.find_last_of(needle[0], pos), view.find_last_of(needle[0], pos));
+            EXPECT_EQ(str.find_first_not_of(needle[0], pos), view.find_first_not_of(needle[0], pos));
+            EXPECT_EQ(str.find_last_not_of(needle[0], pos), view.find_last_not_of(needle[0], pos));
+        }
+    }
+}
+} // namespace search_overloads
+
+TEST(FixedStringTest, SearchOverloadsMatchStringView) {
+    using namespace search_overloads;
+    check(fixed_string<0>{""});
+    check(fixed_string<1>{"c"});
+    check(fixed_string<1>{"x"});
+    check(fixed_string<2>{"ab"});
+    check(fixed_string<2>{"bc"});
+    check(fixed_string<3>{"abc"});
+    check(fixed_string<3>{"cab"});
+    check(fixed_string<5>{"xyzab"});
+    check(fixed_string<5>{"abcab"});
+
+    constexpr fixed_string<3> str = "abc";
+    static_assert(str.find_first_of(fixed_string<5>{"xyzab"}) == 0);
+    static_assert(str.find_first_not_of(fixed_string<2>{"ab"}) == 2);
+    static_assert(str.find_last_not_of(fixed_string<1>{"c"}) == 1);
+    static_assert(str.find_last_of(std::string_view("c")) == 2);
+}
+
+namespace storage_policies
+{
+template <typename T, typename = void>
+constexpr bool has_c_str = false;
+
+template <typename T>
+constexpr bool has_c_str<T, std::void_t<decltype(std::declval<const T&>().c_str())>> = true;
+
+template <std::size_t N>
+using aligned_string = basic_fixed_string<char, N, std::char_traits<char>, aligned<16>>;
+
+template <std::size_t N>
+using record_field = basic_fixed_string<char, N, std::char_traits<char>, unterminated>;
+
+template <std::size_t N>
+void check()
+{
+    // same-size comparisons of padded strings compare whole blocks including the zeroed tail
+    fixed_string<N> text;
+    for (std::size_t i = 0; i < N; ++i)
+        text[i] = static_cast<char>('a' + i % 26);
+    const aligned_string<N> base(text);
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        auto other = base;
+        other[i] = 'Z';
+        EXPECT_FALSE(base == other);
+        EXPECT_TRUE(other < base);
+        EXPECT_TRUE(other < aligned_string<N>(base));
+        EXPECT_EQ(std::string_view(other) < std::string_view(base), other < base);
+    }
+    EXPECT_TRUE(base == aligned_string<N>(text));
+    EXPECT_TRUE(base == record_field<N>(text));
+    EXPECT_TRUE(base == text);
+    EXPECT_FALSE(base < text);
+}
+
+template <std::size_t... Sizes>
+void check_all(std::index_sequence<Sizes...>)
+{
+    (check<Sizes>(), ...);
+}
+} // namespace storage_policies
+
+TEST(FixedStringTest, StoragePolicies) {
+    using namespace storage_policies;
+    static_assert(sizeof(fixed_string<15>) == 16 && alignof(fixed_string<15>) == 1);
+    static_assert(sizeof(aligned_string<15>) == 16 && alignof(aligned_string<15>) == 16);
+    static_assert(sizeof(aligned_string<16>) == 32);
+    static_assert(sizeof(basic_fixed_string<char16_t, 3, std::char_traits<char16_t>, aligned<16>>) == 16);
+    static_assert(sizeof(record_field<8>) == 8 && alignof(record_field<8>) == 1);
+    static_assert(has_c_str<fixed_string<8>> && has_c_str<aligned_string<8>> && !has_c_str<record_field<8>>);
+
+    constexpr aligned_string<5> padded = "hello";
+    static_assert(padded.size() == 5 && padded == std::string_view("hello"));
+    static_assert(padded._data[5] == '\0' && padded._data[15] == '\0');
+    static_assert(padded.find('l') == 2 && padded.ends_with("llo"));
+    static_assert(*padded.rbegin() == 'o' && padded.rend() - padded.rbegin() == 5);
+
+    constexpr record_field<5> field = "hello";
+    static_assert(field == padded && padded == field);
+    static_assert(field.end() - field.begin() == 5 && field.back() == 'o');
+    static_assert(record_field<5>(padded) == fixed_string<5>("hello"));
+    static_assert(fixed_string<5>(field) == padded);
+
+    EXPECT_EQ(fixstr::hash()(padded), fixstr::hash()(fixed_string<5>("hello")));
+    EXPECT_EQ(std::hash<record_field<5>>()(field), fixstr::hash()(std::string_view("hello")));
+    EXPECT_EQ(concat(field, '!', padded), fixed_string<11>("hello!hello"));
+
+    std::ostringstream out;
+    out << field << padded;
+    EXPECT_EQ(out.str(), "hellohello");
+
+    check_all(std::make_index_sequence<40>{});
+}
+
+TEST(FixedStringTest, FixedStringView) {
+    // a fixed-width record: 8-byte symbol, 7-digit quantity, 6-byte venue, no terminators between fields
+    static constexpr char            record[] = "AAPL    0001234NASDAQ";
+    static constexpr fixed_string<8> symbol = "AAPL    ";
+
+    constexpr fixed_string_view<8> field(record);
+    static_assert(field.size() == 8 && field.data() == record);
+    static_assert(field == symbol && symbol == field && !(field < symbol) && field <= symbol);
+    static_assert(field != fixed_string<8>("MSFT    ") && field < fixed_string<8>("MSFT    "));
+    static_assert(field == std::string_view("AAPL    ") && field != "AAPL" && "AAPL" < field);
+    static_assert(field == fixed_string_view<8>(symbol) && field == basic_fixed_string_view(symbol));
+
+    constexpr auto ticker = field.substr<0, 4>();
+    static_assert(std::is_same_v<decltype(ticker), const fixed_string_view<4>>);
+    static_assert(ticker.data() == record && ticker == fixed_string<4>("AAPL"));
+    static_assert(fixed_string_view<6>(record + 15).substr<3>() == std::string_view("DAQ"));
+
+    static_assert(field.find('P') == 2 && field.rfind(' ') == 7 && field.find_first_not_of("AP") == 3);
+    static_assert(field.starts_with("AA") && field.ends_with(' ') && field.contains("PL") && !field.contains('Z'));
+    static_assert(field.front() == 'A' && field.back() == ' ' && *field.rbegin() == ' ' && field.at(2) == 'P');
+    static_assert(fixed_string<8>(field) == symbol);
+    static_assert(concat(ticker, '.', fixed_string_view<6>(record + 15)) == fixed_string<11>("AAPL.NASDAQ"));
+
+    EXPECT_EQ(fixstr::hash()(field), fixstr::hash()(symbol));
+    EXPECT_EQ(std::hash<fixed_string_view<8>>()(field), fixstr::hash()(std::string_view("AAPL    ")));
+    EXPECT_TRUE(utils::throws<std::out_of_range>([&] { (void)field.at(8); }));
+    EXPECT_TRUE(utils::throws<std::length_error>([&] { fixed_string_view<8> wrong{std::string_view(record)}; }));
+    EXPECT_EQ(fixed_string_view<8>(std::string_view(record, 8)), symbol);
+
+    // same-size comparisons go through the fixed-size kernels and must agree with string_view
+    const std::string runtime = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    const fixed_string_view<36> lhs(runtime.data());
+    for (std::size_t i = 0; i < runtime.size(); ++i)
+    {
+        std::string changed = runtime;
+        changed[i] = '#';
+        const fixed_string_view<36> rhs(changed.data());
+        EXPECT_FALSE(lhs == rhs);
+        EXPECT_TRUE(rhs < lhs);
+        EXPECT_TRUE(lhs > fixed_string<36>(rhs));
+    }
+
+    std::ostringstream out;
+    out << ticker << '/' << fixed_string_view<6>(record + 15);
+    EXPECT_EQ(out.str(), "AAPL/NASDAQ");
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+    static_assert(field.find<"PL">() == 2 && !field.contains<"XX">());
 #endif // FIXSTR_CPP20_CNTTP_PRESENT
+}
 
 namespace swapping
 {
@@ -617,11 +1075,43 @@ void check()
     constexpr auto                  fixed_str = utils::to_fs_2<T>(literal);
 
     const auto fixed_str_hash = std::hash<T<fixed_str.size()>>()(fixed_str);
-    const auto string_view_hash = std::hash<sv_t>()(static_cast<sv_t>(fixed_str));
+    const auto string_view_hash = fixstr::hash()(static_cast<sv_t>(fixed_str));
     EXPECT_EQ(string_view_hash, fixed_str_hash);
+    EXPECT_EQ(fixstr::hash()(fixed_str), fixed_str_hash);
+
+    constexpr auto constexpr_hash = std::hash<T<fixed_str.size()>>()(fixed_str);
+    EXPECT_EQ(constexpr_hash, fixed_str_hash);
 }
 } // namespace hash_support
 
+namespace hash_algorithms
+{
+constexpr fixed_string<64> text = "The quick brown fox jumps over the lazy dog, again and again!!!!";
+
+template <typename THash, std::size_t... Lengths>
+void check(std::index_sequence<Lengths...>)
+{
+    // the hash computed at compile time must match both runtime code paths for every length
+    constexpr std::size_t compile_time[] = {THash()(text.template substr<0, Lengths>())...};
+    const std::string     runtime_text(text.data(), text.size());
+    std::size_t           i = 0;
+    for (const auto length : {Lengths...})
+    {
+        const auto sv = std::string_view(runtime_text).substr(0, length);
+        EXPECT_EQ(THash()(sv), compile_time[i]);
+        ++i;
+    }
+    const std::size_t runtime[] = {THash()(text.template substr<0, Lengths>())...};
+    EXPECT_TRUE(std::equal(std::begin(runtime), std::end(runtime), std::begin(compile_time)));
+}
+
+template <typename TAlgorithm>
+constexpr std::uint64_t hash_prefix(std::size_t length)
+{
+    return TAlgorithm::hash(fixstr::details::hashing::byte_reader<char>{text.data()}, length, 0);
+}
+} // namespace hash_algorithms
+
 TEST(FixedStringTest, HashSupport) {
     using namespace hash_support;
     check<fixed_string>();
@@ -633,6 +1123,58 @@ TEST(FixedStringTest, HashSupport) {
     check<fixed_u32string>();
 }
 
+TEST(FixedStringTest, HashMatchesAtCompileTimeAndRuntime) {
+    using namespace hash_algorithms;
+    check<fixstr::hash>(std::make_index_sequence<65>{});
+    check<fixstr::fnv1a_hash>(std::make_index_sequence<65>{});
+}
+
+TEST(FixedStringTest, HashKnownValues) {
+    // reference FNV-1a 64 values
+    static_assert(fixstr::hashing::fnv1a::hash(fixstr::details::hashing::byte_reader<char>{""}, 0, 0) == 0xcbf29ce484222325ULL);
+    static_assert(fixstr::hashing::fnv1a::hash(fixstr::details::hashing::byte_reader<char>{"a"}, 1, 0) == 0xaf63dc4c8601ec8cULL);
+    static_assert(fixstr::hashing::fnv1a::hash(fixstr::details::hashing::byte_reader<char>{"foobar"}, 6, 0) == 0x85944171f73967e8ULL);
+
+    // reference values around the boundaries of the wyhash code paths
+    using hash_algorithms::hash_prefix;
+    static_assert(hash_prefix<hashing::wyhash>(0) == 0x93228a4de0eec5a2ULL);
+    static_assert(hash_prefix<hashing::wyhash>(3) == 0x00cc0db61c82aab6ULL);
+    static_assert(hash_prefix<hashing::wyhash>(8) == 0x292abc6c6b4f7237ULL);
+    static_assert(hash_prefix<hashing::wyhash>(16) == 0xc204acd0b92d4876ULL);
+    static_assert(hash_prefix<hashing::wyhash>(17) == 0xa0b84d0c7f108a6bULL);
+    static_assert(hash_prefix<hashing::wyhash>(48) == 0x8f27428a7e81e5e4ULL);
+    static_assert(hash_prefix<hashing::wyhash>(49) == 0xc82517d2a91bc35fULL);
+    static_assert(hash_prefix<hashing::fnv1a>(0) == 0xcbf29ce484222325ULL);
+    static_assert(hash_prefix<hashing::fnv1a>(3) == 0x6cfee919e21ae1dcULL);
+    static_assert(hash_prefix<hashing::fnv1a>(8) == 0x9cd2d72b4a8d2dc2ULL);
+    static_assert(hash_prefix<hashing::fnv1a>(16) == 0x48198a990deef031ULL);
+    static_assert(hash_prefix<hashing::fnv1a>(17) == 0x7256d912ad0263d5ULL);
+    static_assert(hash_prefix<hashing::fnv1a>(48) == 0x1937c9b45df01573ULL);
+    static_assert(hash_prefix<hashing::fnv1a>(49) == 0xc9e0d77b9ef3db2eULL);
+
+    // the same values from a runtime buffer
+    const std::string runtime_text(hash_algorithms::text.data(), 49);
+    const auto        runtime_hash = [&](auto algorithm, std::size_t length) {
+        return decltype(algorithm)::hash(fixstr::details::hashing::byte_reader<char>{runtime_text.data()}, length, 0);
+    };
+    EXPECT_EQ(runtime_hash(hashing::wyhash{}, 17), 0xa0b84d0c7f108a6bULL);
+    EXPECT_EQ(runtime_hash(hashing::wyhash{}, 48), 0x8f27428a7e81e5e4ULL);
+    EXPECT_EQ(runtime_hash(hashing::wyhash{}, 49), 0xc82517d2a91bc35fULL);
+    EXPECT_EQ(runtime_hash(hashing::fnv1a{}, 49), 0xc9e0d77b9ef3db2eULL);
+
+    constexpr fixed_wstring<3> wide = L"abc";
+    EXPECT_EQ(fixstr::hash()(wide), fixstr::hash()(std::wstring_view(L"abc")));
+    EXPECT_TRUE(fixstr::hash()(fixed_string<3>("abc")) != fixstr::hash()(fixed_string<3>("abd")));
+}
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+TEST(FixedStringTest, HashVariableTemplate) {
+    static_assert(hash_v<"Hello"> == fixstr::hash()(fixed_string<5>("Hello")));
+    static_assert(hash_v<"Hello", hashing::fnv1a> == fixstr::fnv1a_hash()(fixed_string<5>("Hello")));
+    static_assert(hash_v<u"Hello"> == fixstr::hash()(std::u16string_view(u"Hello")));
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+
 namespace front_and_back
 {
 namespace logic
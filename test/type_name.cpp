@@ -0,0 +1,82 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <minitest/minitest.h>
+#include <string_view>
+#include <type_traits>
+
+#include "fixstr/type_name.hpp"
+
+using namespace fixstr;
+using namespace std::string_view_literals;
+
+namespace type_name_test
+{
+struct widget
+{
+};
+
+template <typename T>
+struct holder
+{
+};
+
+enum class level
+{
+    low
+};
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+template <basic_fixed_string Name>
+struct tagged
+{
+    static constexpr std::string_view name = Name;
+};
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
+} // namespace type_name_test
+
+TEST(TypeNameTest, SpellsQualifiedNames) {
+    using namespace type_name_test;
+    static_assert(type_name<int>() == "int"sv);
+    static_assert(type_name<widget>() == "type_name_test::widget"sv);
+    static_assert(type_name<holder<widget>>() == "type_name_test::holder<type_name_test::widget>"sv);
+    static_assert(type_name<level>() == "type_name_test::level"sv);
+    static_assert(std::is_same_v<decltype(type_name<widget>()), basic_fixed_string<char, 22>>);
+    static_assert(type_name_v<const widget*> == type_name<const widget*>());
+}
+
+TEST(TypeNameTest, HashesTheName) {
+    using namespace type_name_test;
+    static_assert(type_hash<widget>() == hash{}(type_name<widget>()));
+    static_assert(type_hash_v<widget, hashing::fnv1a> == fnv1a_hash{}(type_name<widget>()));
+    static_assert(type_hash<widget>() != type_hash<holder<widget>>());
+    EXPECT_EQ(type_hash<level>(), hash{}("type_name_test::level"sv));
+}
+
+#if FIXSTR_CPP20_CNTTP_PRESENT
+TEST(TypeNameTest, NamesAsNonTypeTemplateParameters) {
+    using namespace type_name_test;
+    static_assert(tagged<type_name<widget>()>::name == "type_name_test::widget");
+}
+#endif // FIXSTR_CPP20_CNTTP_PRESENT
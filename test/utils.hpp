@@ -0,0 +1,97 @@
+/*
+    Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+    SPDX-License-Identifier: MIT
+    Copyright (c) 2020 - 2020 Daniil Dudkin.
+
+    Permission is hereby  granted, free of charge, to any  person obtaining a copy
+    of this software and associated  documentation files (the "Software"), to deal
+    in the Software  without restriction, including without  limitation the rights
+    to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+    copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+    IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+    FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+    AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+    LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef FIXSTR_TEST_UTILS_HPP
+#define FIXSTR_TEST_UTILS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "fixed_string.hpp"
+
+namespace utils
+{
+// EXPECT_TRUE(utils::throws<std::length_error>([&] { ... }))
+template <typename TException, typename TFunction>
+bool throws(TFunction f)
+{
+    try
+    {
+        f();
+    }
+    catch (const TException&)
+    {
+        return true;
+    }
+    return false;
+}
+
+// Linear congruential generator for test data, the sequence is the same with every standard library
+class lcg
+{
+  public:
+    explicit lcg(std::uint32_t seed) noexcept : _state(seed) {}
+
+    std::uint32_t operator()() noexcept
+    {
+        _state = _state * 1103515245u + 12345u;
+        return _state >> 16;
+    }
+
+  private:
+    std::uint32_t _state;
+};
+
+// Keys of a fixed string type with characters drawn from `alphabet`.
+// Small alphabets give long shared prefixes and many duplicates.
+template <typename TKey>
+std::vector<TKey> random_keys(std::size_t count, std::string_view alphabet, std::uint32_t seed)
+{
+    std::vector<TKey> result(count);
+    lcg               random(seed);
+    for (auto& key : result)
+    {
+        for (auto& ch : key)
+            ch = alphabet[random() % alphabet.size()];
+    }
+    return result;
+}
+
+// The distinct key number `i`, written in base 26 with the letters A to Z
+template <std::size_t N>
+fixstr::fixed_string<N> make_key(std::uint32_t i)
+{
+    fixstr::fixed_string<N> key;
+    for (auto& ch : key)
+    {
+        ch = static_cast<char>('A' + i % 26);
+        i /= 26;
+    }
+    return key;
+}
+} // namespace utils
+
+#endif // FIXSTR_TEST_UTILS_HPP